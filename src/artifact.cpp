@@ -2,6 +2,7 @@
 
 #include "output.h" // string_format
 #include "item_factory.h"
+#include "init.h"
 #include "debug.h"
 #include "json.h"
 #include "cata_utility.h"
@@ -258,6 +259,8 @@ it_artifact_tool::it_artifact_tool() : itype()
     tool.reset( new islot_tool() );
     artifact.reset( new islot_artifact() );
     id = item_controller->create_artifact_id();
+    // A new type of item that was not loaded with the rest of the data.
+    DynamicDataLoader::get_instance().loaded_data_changed();
     price = 0;
     tool->charges_per_use = 1;
     artifact->charge_type = ARTC_NULL;
@@ -277,6 +280,7 @@ it_artifact_armor::it_artifact_armor() : itype()
     armor.reset( new islot_armor() );
     artifact.reset( new islot_artifact() );
     id = item_controller->create_artifact_id();
+    DynamicDataLoader::get_instance().loaded_data_changed();
     price = 0;
 }
 
@@ -1475,7 +1475,8 @@ void cata_tiles::init_minimap( int destx, int desty, int width, int height )
     minimap_tile_size.x = std::max( width / minimap_tiles_range.x, 1 );
     minimap_tile_size.y = std::max( height / minimap_tiles_range.y, 1 );
     //maintain a square "pixel" shape
-    if( get_option<bool>( "PIXEL_MINIMAP_RATIO" ) ) {
+    static const cached_option<bool> pixel_minimap_ratio( "PIXEL_MINIMAP_RATIO" );
+    if( pixel_minimap_ratio.get() ) {
         int smallest_size = std::min( minimap_tile_size.x, minimap_tile_size.y );
         minimap_tile_size.x = smallest_size;
         minimap_tile_size.y = smallest_size;
@@ -1622,7 +1623,8 @@ void cata_tiles::draw_minimap( int destx, int desty, const tripoint &center, int
 
     //handles the enemy faction red highlights
     //this value should be divisible by 200
-    const int indicator_length = get_option<int>( "PIXEL_MINIMAP_BLINK" ) * 200; //default is 2000 ms, 2 seconds
+    static const cached_option<int> pixel_minimap_blink( "PIXEL_MINIMAP_BLINK" );
+    const int indicator_length = pixel_minimap_blink.get() * 200; //default is 2000 ms, 2 seconds
     int indicator_tick = 0; //if blink is disabled, leave at 0
     if( indicator_length > 0 ) {
         indicator_tick = SDL_GetTicks() % indicator_length;
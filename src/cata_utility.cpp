@@ -424,13 +424,53 @@ bool write_to_file_exclusive( const std::string &path,
     }
 }
 
+memory_streambuf::memory_streambuf( const char *const data, const size_t size )
+{
+    // The get area is never written to, std::streambuf just doesn't know const.
+    char *const begin = const_cast<char *>( data );
+    setg( begin, begin, begin + size );
+}
+
+memory_streambuf::pos_type memory_streambuf::seekoff( const off_type off,
+        const std::ios_base::seekdir dir, const std::ios_base::openmode which )
+{
+    if( ( which & std::ios_base::in ) == 0 ) {
+        return pos_type( off_type( -1 ) );
+    }
+    off_type base = 0;
+    if( dir == std::ios_base::cur ) {
+        base = gptr() - eback();
+    } else if( dir == std::ios_base::end ) {
+        base = egptr() - eback();
+    }
+    const off_type target = base + off;
+    if( target < 0 || target > egptr() - eback() ) {
+        return pos_type( off_type( -1 ) );
+    }
+    setg( eback(), eback() + target, egptr() );
+    return pos_type( target );
+}
+
+memory_streambuf::pos_type memory_streambuf::seekpos( const pos_type pos,
+        const std::ios_base::openmode which )
+{
+    return seekoff( off_type( pos ), std::ios_base::beg, which );
+}
+
+imemstream::imemstream( const char *const data, const size_t size )
+    : std::istream( nullptr ), buffer( data, size )
+{
+    rdbuf( &buffer );
+}
+
 bool read_from_file( const std::string &path, const std::function<void( std::istream & )> &reader )
 {
     try {
-        std::ifstream fin( path, std::ios::binary );
-        if( !fin ) {
+        const mapped_file file( path );
+        if( !file.is_open() ) {
             throw std::runtime_error( "opening file failed" );
         }
+        imemstream fin( file.data(), file.size() );
         reader( fin );
         if( fin.bad() ) {
             throw std::runtime_error( "reading file failed" );
@@ -164,12 +164,38 @@ class ofstream_wrapper
  */
 bool write_to_file( const std::string &path, const std::function<void( std::ostream & )> &writer,
                     const char *fail_message );
+/**
+ * Stream buffer over a block of memory that must stay valid (and unchanged) while the
+ * buffer is used. Unlike std::stringbuf, it does not copy the data, and seeking and
+ * telling the position (which @ref JsonIn does a lot) are plain pointer arithmetic.
+ */
+class memory_streambuf : public std::streambuf
+{
+    public:
+        memory_streambuf( const char *data, size_t size );
+
+    protected:
+        pos_type seekoff( off_type off, std::ios_base::seekdir dir,
+                          std::ios_base::openmode which ) override;
+        pos_type seekpos( pos_type pos, std::ios_base::openmode which ) override;
+};
+
+/** Input stream reading from a @ref memory_streambuf. */
+class imemstream : public std::istream
+{
+    private:
+        memory_streambuf buffer;
+
+    public:
+        imemstream( const char *data, size_t size );
+};
+
 class JsonIn;
 class JsonDeserializer;
 /**
  * Try to open and read from given file using the given callback.
- * The file is opened for reading (binary mode), given to the callback (which does the actual
- * reading) and closed.
+ * The file is opened for reading (binary mode, memory mapped if possible), given to the
+ * callback (which does the actual reading) and closed.
  * Any exceptions from the callbacks are caught and reported as `debugmsg`.
  * If the stream is in a fail state (other than EOF) after the callback returns, it is handled as
  * error as well.
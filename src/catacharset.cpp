@@ -134,9 +134,18 @@ int utf8_width(const char *s, const bool ignore_tags)
     int w = 0;
     bool inside_tag = false;
     while(len > 0) {
-        uint32_t ch = UTF8_getch(&ptr, &len);
-        if (ch == UNKNOWN_UNICODE) {
-            continue;
+        uint32_t ch;
+        const unsigned char first = *ptr;
+        if( first >= 0x20 && first < 0x7F ) {
+            // Printable ASCII, most of the text: one byte and one column, no need to decode it.
+            ch = first;
+            ptr++;
+            len--;
+        } else {
+            ch = UTF8_getch(&ptr, &len);
+            if (ch == UNKNOWN_UNICODE) {
+                continue;
+            }
         }
         if (ignore_tags) {
             if (ch == '<') {
@@ -149,7 +158,7 @@ int utf8_width(const char *s, const bool ignore_tags)
                 continue;
             }
         }
-        w += mk_wcwidth(ch);
+        w += ch < 0x7F && ch >= 0x20 ? 1 : mk_wcwidth(ch);
     }
     return w;
 }
@@ -17,6 +17,8 @@ class field;
 class field_entry;
 class vehicle;
 struct resistances;
+struct mutation_branch;
+using trait_id = string_id<mutation_branch>;
 
 enum vision_modes {
     DEBUG_NIGHTVISION,
@@ -223,6 +225,11 @@ class Character : public Creature, public visitable<Character>
         // In mutation.cpp
         /** Returns true if the player has the entered trait */
         bool has_trait(const std::string &flag) const override;
+        /**
+         * Same as above, but looks the trait up in @ref trait_lookup by its int id. Hot paths
+         * should use this with a static trait_id, which caches the int id.
+         */
+        bool has_trait( const trait_id &flag ) const;
         /** Returns true if the player has the entered starting trait */
         bool has_base_trait(const std::string &flag) const;
         /** Returns true if player has a trait with a flag */
@@ -582,6 +589,10 @@ class Character : public Creature, public visitable<Character>
          * Contains mutation ids of the base traits.
          */
         std::unordered_set<std::string> my_traits;
+        /** Must be called when entries of @ref my_mutations are replaced, see @ref trait_lookup. */
+        void invalidate_trait_lookup() {
+            trait_lookup_generation = -1;
+        }
 
         void store(JsonOut &jsout) const;
         void load(JsonObject &jsin);
@@ -603,6 +614,15 @@ class Character : public Creature, public visitable<Character>
         mutable pathfinding_settings path_settings;
 
     private:
+        /**
+         * Whether the character has a mutation, indexed by its int id. Rebuilt from
+         * @ref my_mutations when its size or the mutation data (see
+         * mutation_branch::generation) changed, or when it has been invalidated.
+         */
+        mutable std::vector<bool> trait_lookup;
+        mutable size_t trait_lookup_size = 0;
+        mutable int trait_lookup_generation = -1;
+
         /** Needs (hunger, thirst, fatigue, etc.) */
         int hunger;
         int thirst;
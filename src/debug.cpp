@@ -3,6 +3,7 @@
 #include "output.h"
 #include "filesystem.h"
 #include <time.h>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstdarg>
@@ -43,15 +44,23 @@ namespace
 {
 
 std::set<std::string> ignored_messages;
+// Worker threads (e.g. loading data or generating overmaps) can report errors, too.
+std::atomic<unsigned int> debugmsg_calls( 0 );
 
 }
 
+unsigned int debugmsg_count()
+{
+    return debugmsg_calls;
+}
+
 void realDebugmsg( const char *filename, const char *line, const char *funcname, const char *mes,
                    ... )
 {
     assert( filename != nullptr );
     assert( line != nullptr );
     assert( funcname != nullptr );
+    debugmsg_calls++;
 
     va_list ap;
     va_start( ap, mes );
@@ -66,6 +66,8 @@
 // Don't use this, use debugmsg instead.
 void realDebugmsg( const char *filename, const char *line, const char *funcname, const char *mes,
                    ... ) PRINTF_LIKE( 4, 5 );
+/** Number of debugmsg calls so far, including ignored messages. */
+unsigned int debugmsg_count();
 
 // Enumerations                                                     {{{1
 // ---------------------------------------------------------------------
@@ -200,8 +200,8 @@ void defense_game::init_map()
     auto &starting_om = overmap_buffer.get( 0, 0 );
     for (int x = 0; x < OMAPX; x++) {
         for (int y = 0; y < OMAPY; y++) {
-            starting_om.ter(x, y, 0) = oter_id( "field" );
-            starting_om.seen(x, y, 0) = true;
+            starting_om.set_ter(x, y, 0, oter_id( "field" ));
+            starting_om.set_seen(x, y, 0, true);
         }
     }
 
@@ -214,41 +214,41 @@ void defense_game::init_map()
     case DEFLOC_HOSPITAL:
         for (int x = 49; x <= 51; x++) {
             for (int y = 49; y <= 51; y++) {
-                starting_om.ter(x, y, 0) = oter_id( "hospital" );
+                starting_om.set_ter(x, y, 0, oter_id( "hospital" ));
             }
         }
-        starting_om.ter(50, 49, 0) = oter_id( "hospital_entrance" );
+        starting_om.set_ter(50, 49, 0, oter_id( "hospital_entrance" ));
         break;
 
     case DEFLOC_WORKS:
         for (int x = 49; x <= 50; x++) {
             for (int y = 49; y <= 50; y++) {
-                starting_om.ter(x, y, 0) = oter_id( "public_works" );
+                starting_om.set_ter(x, y, 0, oter_id( "public_works" ));
             }
         }
-        starting_om.ter(50, 49, 0) = oter_id( "public_works_entrance" );
+        starting_om.set_ter(50, 49, 0, oter_id( "public_works_entrance" ));
         break;
 
     case DEFLOC_MALL:
         for (int x = 49; x <= 51; x++) {
             for (int y = 49; y <= 51; y++) {
-                starting_om.ter(x, y, 0) = oter_id( "megastore" );
+                starting_om.set_ter(x, y, 0, oter_id( "megastore" ));
             }
         }
-        starting_om.ter(50, 49, 0) = oter_id( "megastore_entrance" );
+        starting_om.set_ter(50, 49, 0, oter_id( "megastore_entrance" ));
         break;
 
     case DEFLOC_BAR:
-        starting_om.ter(50, 50, 0) = oter_id( "bar_north" );
+        starting_om.set_ter(50, 50, 0, oter_id( "bar_north" ));
         break;
 
     case DEFLOC_MANSION:
         for (int x = 49; x <= 51; x++) {
             for (int y = 49; y <= 51; y++) {
-                starting_om.ter(x, y, 0) = oter_id( "mansion" );
+                starting_om.set_ter(x, y, 0, oter_id( "mansion" ));
             }
         }
-        starting_om.ter(50, 49, 0) = oter_id( "mansion_entrance" );
+        starting_om.set_ter(50, 49, 0, oter_id( "mansion_entrance" ));
         break;
     }
     starting_om.save();
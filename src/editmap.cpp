@@ -1683,10 +1683,9 @@ int editmap::mapgen_preview( real_coords &tc, uimenu &gmenu )
 
     // Coordinates of the overmap terrain that should be generated.
     const point omt_pos = ms_to_omt_copy( tc.abs_pos );
-    oter_id &omt_ref = overmap_buffer.ter( omt_pos.x, omt_pos.y, target.z );
     // Copy to store the original value, to restore it upon canceling
-    const oter_id orig_oters = omt_ref;
-    omt_ref = oter_id( gmenu.ret );
+    const oter_id orig_oters = overmap_buffer.ter( omt_pos.x, omt_pos.y, target.z );
+    overmap_buffer.set_ter( omt_pos.x, omt_pos.y, target.z, oter_id( gmenu.ret ) );
     tinymap tmpmap;
     // TODO: add a do-not-save-generated-submaps parameter
     // TODO: keep track of generated submaps to delete them properly and to avoid memory leaks
@@ -1722,7 +1721,7 @@ int editmap::mapgen_preview( real_coords &tc, uimenu &gmenu )
     do {
         if( gmenu.selected != lastsel ) {
             lastsel = gmenu.selected;
-            omt_ref = oter_id( gmenu.selected );
+            overmap_buffer.set_ter( omt_pos.x, omt_pos.y, target.z, oter_id( gmenu.selected ) );
             cleartmpmap( tmpmap );
             tmpmap.generate( omt_pos.x * 2, omt_pos.y * 2, target.z, calendar::turn );
             showpreview = true;
@@ -1835,6 +1834,7 @@ int editmap::mapgen_preview( real_coords &tc, uimenu &gmenu )
                     popup( _( "Changed 4 submaps\n%s" ), s.c_str() );
 
                 } else if( gpmenu.ret == 3 ) {
+                    const oter_id &omt_ref = overmap_buffer.ter( omt_pos.x, omt_pos.y, target.z );
                     popup( _( "Changed oter_id from '%s' (%s) to '%s' (%s)" ),
                            orig_oters->name.c_str(), orig_oters.id().c_str(),
                            omt_ref->name.c_str(), omt_ref.id().c_str() );
@@ -1863,7 +1863,7 @@ int editmap::mapgen_preview( real_coords &tc, uimenu &gmenu )
     update_view( true );
     if( gpmenu.ret != 2 &&  // we didn't apply, so restore the original om_ter
         gpmenu.ret != 3 ) { // chose to change oter_id but not apply mapgen
-        omt_ref = orig_oters;
+        overmap_buffer.set_ter( omt_pos.x, omt_pos.y, target.z, orig_oters );
     }
     gmenu.border_color = c_magenta;
     gmenu.hilight_color = h_white;
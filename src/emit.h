@@ -51,6 +51,9 @@ class emit
         /** Get all currently loaded emission data */
         static const std::map<emit_id, emit> &all();
 
+        /** Resolve the field types of all loaded emission data */
+        static void finalize();
+
         /** Check consistency of all loaded emission data */
         static void check_consistency();
 
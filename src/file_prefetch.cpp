@@ -0,0 +1,193 @@
+#include "file_prefetch.h"
+
+#include "cata_utility.h"
+#include "debug.h"
+#include "filesystem.h"
+#include "json.h"
+#include "translations.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+static bool read_whole_file( const std::string &path, std::string &contents )
+{
+    std::ifstream fin( path, std::ios::binary );
+    if( !fin ) {
+        return false;
+    }
+    fin.seekg( 0, std::ios::end );
+    const std::streamoff size = fin.tellg();
+    if( size <= 0 ) {
+        return size == 0;
+    }
+    fin.seekg( 0, std::ios::beg );
+    contents.resize( size );
+    fin.read( &contents[0], size );
+    return !fin.fail();
+}
+
+file_prefetcher::file_prefetcher( const size_t max_workers, const size_t max_staged )
+    : max_workers( std::max<size_t>( max_workers, 1 ) ), max_staged( max_staged )
+{
+}
+
+file_prefetcher::~file_prefetcher()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        stopping = true;
+        pending.clear();
+    }
+    wakeup.notify_all();
+    for( auto &worker : workers ) {
+        if( worker.joinable() ) {
+            worker.join();
+        }
+    }
+}
+
+void file_prefetcher::request( const std::string &path )
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        if( staged.count( path ) > 0 || in_flight.count( path ) > 0 ) {
+            return;
+        }
+        if( pending.size() >= max_staged ) {
+            return;
+        }
+        if( std::find( pending.begin(), pending.end(), path ) != pending.end() ) {
+            return;
+        }
+        pending.push_back( path );
+        // Workers are only started once something is actually requested (and only as many
+        // as there is work for), games that never leave the starting area don't need them.
+        if( workers.size() < max_workers && workers.size() < pending.size() + in_flight.size() ) {
+            workers.emplace_back( &file_prefetcher::run, this );
+        }
+    }
+    wakeup.notify_one();
+}
+
+bool file_prefetcher::take( const std::string &path, bool &exists, std::string &contents )
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    // A file that is being read right now is almost there, reading it again would only
+    // compete with the worker for the disk.
+    finished.wait( lock, [this, &path]() {
+        return in_flight.count( path ) == 0;
+    } );
+    const auto iter = staged.find( path );
+    if( iter == staged.end() ) {
+        // The caller reads it now, a copy staged later could become outdated.
+        pending.erase( std::remove( pending.begin(), pending.end(), path ), pending.end() );
+        return false;
+    }
+    exists = iter->second.exists;
+    contents = std::move( iter->second.contents );
+    staged.erase( iter );
+    staged_order.erase( std::find( staged_order.begin(), staged_order.end(), path ) );
+    return true;
+}
+
+bool file_prefetcher::read_optional( const std::string &path,
+                                     const std::function<void( std::istream & )> &reader )
+{
+    bool exists = false;
+    std::string contents;
+    if( !take( path, exists, contents ) ) {
+        return read_from_file_optional( path, reader );
+    }
+    if( !exists ) {
+        return false;
+    }
+    // Same error handling as read_from_file.
+    try {
+        imemstream fin( contents.data(), contents.size() );
+        reader( fin );
+        if( fin.bad() ) {
+            throw std::runtime_error( "reading file failed" );
+        }
+        return true;
+    } catch( const std::exception &err ) {
+        debugmsg( _( "Failed to read from \"%1$s\": %2$s" ), path.c_str(), err.what() );
+        return false;
+    }
+}
+
+bool file_prefetcher::read_optional( const std::string &path,
+                                     const std::function<void( JsonIn & )> &reader )
+{
+    return read_optional( path, [&reader]( std::istream & fin ) {
+        JsonIn jsin( fin );
+        reader( jsin );
+    } );
+}
+
+void file_prefetcher::discard( const std::string &path )
+{
+    std::lock_guard<std::mutex> lock( mutex );
+    if( staged.erase( path ) > 0 ) {
+        staged_order.erase( std::find( staged_order.begin(), staged_order.end(), path ) );
+    }
+    pending.erase( std::remove( pending.begin(), pending.end(), path ), pending.end() );
+    if( in_flight.count( path ) > 0 ) {
+        in_flight_discarded.insert( path );
+    }
+}
+
+void file_prefetcher::clear()
+{
+    std::lock_guard<std::mutex> lock( mutex );
+    staged.clear();
+    staged_order.clear();
+    pending.clear();
+    in_flight_discarded = in_flight;
+}
+
+size_t file_prefetcher::staged_count()
+{
+    std::lock_guard<std::mutex> lock( mutex );
+    return staged.size();
+}
+
+void file_prefetcher::run()
+{
+    std::unique_lock<std::mutex> lock( mutex );
+    while( true ) {
+        wakeup.wait( lock, [this]() {
+            return stopping || !pending.empty();
+        } );
+        if( stopping ) {
+            return;
+        }
+        const std::string path = std::move( pending.front() );
+        pending.pop_front();
+        in_flight.insert( path );
+
+        // The actual disk access is done without the lock, so the main thread can keep
+        // taking already staged files.
+        lock.unlock();
+        staged_file result;
+        result.exists = file_exist( path );
+        // If reading an existing file fails, nothing is staged and the main thread reads
+        // it again on its own (and reports the error). Staging it as missing would
+        // cause e.g. the map quad to be generated anew.
+        const bool success = !result.exists || read_whole_file( path, result.contents );
+        lock.lock();
+
+        in_flight.erase( path );
+        const bool discarded = in_flight_discarded.erase( path ) > 0;
+        if( success && !discarded ) {
+            staged[path] = std::move( result );
+            staged_order.push_back( path );
+            // Files the player turned away from are never taken, forget the oldest ones.
+            while( staged.size() > max_staged ) {
+                staged.erase( staged_order.front() );
+                staged_order.pop_front();
+            }
+        }
+        finished.notify_all();
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef FILE_PREFETCH_H
+#define FILE_PREFETCH_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#if ((defined _WIN32 || defined WINDOWS) && !defined _MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+class JsonIn;
+
+/**
+ * Reads save files on background threads, before the game needs them.
+ *
+ * @ref mapbuffer uses it for the map quads ahead of the reality bubble, @ref overmapbuffer
+ * for the overmaps around the player when a game is loaded. The staged file contents
+ * are handed over by @ref read_optional, which parses them from memory instead of
+ * waiting for the disk. Only the file reading happens on the worker threads:
+ * deserializing creates items, vehicles, monsters and NPCs, which touches global game
+ * data that is not thread safe.
+ */
+class file_prefetcher
+{
+    public:
+        /**
+         * @param max_workers Number of worker threads that read files at the same time.
+         * @param max_staged Upper bound for staged and for pending files.
+         */
+        file_prefetcher( size_t max_workers, size_t max_staged );
+        ~file_prefetcher();
+
+        /** Queue reading the file at @p path in the background. */
+        void request( const std::string &path );
+        /**
+         * Hand over the staged data of a file. If the file is currently being read by a
+         * worker, this waits for it.
+         * @param exists Set to whether the file existed when it was read.
+         * @param contents Receives the file contents.
+         * @return Whether the file was staged. If not, the caller has to read it on its own.
+         */
+        bool take( const std::string &path, bool &exists, std::string &contents );
+        /**
+         * Like @ref read_from_file_optional, but uses the staged contents of the file
+         * if there are any.
+         */
+        bool read_optional( const std::string &path,
+                            const std::function<void( std::istream & )> &reader );
+        bool read_optional( const std::string &path,
+                            const std::function<void( JsonIn & )> &reader );
+        /** Forget any staged or pending data of the file, because it is being rewritten. */
+        void discard( const std::string &path );
+        /** Forget everything, e.g. because the world is unloaded. */
+        void clear();
+
+        /** Number of files currently staged, for the debug menu. */
+        size_t staged_count();
+
+    private:
+        struct staged_file {
+            bool exists;
+            std::string contents;
+        };
+
+        void run();
+
+        const size_t max_workers;
+        const size_t max_staged;
+
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        /** Notified whenever a worker finishes a file. */
+        std::condition_variable finished;
+        std::deque<std::string> pending;
+        std::map<std::string, staged_file> staged;
+        /** Keys of @ref staged, oldest first. */
+        std::deque<std::string> staged_order;
+        /** Files the worker threads are reading right now, without holding the lock. */
+        std::set<std::string> in_flight;
+        /** Subset of @ref in_flight whose results must be dropped. */
+        std::set<std::string> in_flight_discarded;
+        bool stopping = false;
+        std::vector<std::thread> workers;
+};
+
+#endif
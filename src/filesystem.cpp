@@ -23,6 +23,12 @@
 #   include <unistd.h>
 #endif
 
+#if !(defined _WIN32 || defined __WIN32__)
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#endif
+#include <fstream>
+
 #if defined(_WIN32) || defined (__WIN32__)
 #   include "platform_win.h"
 #endif
@@ -108,6 +114,61 @@ bool rename_file(const std::string &old_path, const std::string &new_path)
 }
 #endif
 
+#if (defined _WIN32 || defined __WIN32__)
+mapped_file::mapped_file( const std::string &path )
+{
+    std::ifstream fin( path, std::ios::binary );
+    if( !fin ) {
+        return;
+    }
+    buffer.assign( std::istreambuf_iterator<char>( fin ), std::istreambuf_iterator<char>() );
+    if( fin.bad() ) {
+        return;
+    }
+    contents = buffer.data();
+    length = buffer.size();
+    opened = true;
+}
+
+mapped_file::~mapped_file()
+{
+}
+#else
+mapped_file::mapped_file( const std::string &path )
+{
+    const int fd = open( path.c_str(), O_RDONLY );
+    if( fd == -1 ) {
+        return;
+    }
+    struct stat info;
+    if( fstat( fd, &info ) == 0 && S_ISREG( info.st_mode ) ) {
+        length = info.st_size;
+        if( length == 0 ) {
+            // Can't map an empty file, but there is nothing to read anyway.
+            opened = true;
+        } else {
+            void *const addr = mmap( nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if( addr != MAP_FAILED ) {
+                contents = static_cast<const char *>( addr );
+                mapped = true;
+                opened = true;
+            } else {
+                length = 0;
+            }
+        }
+    }
+    // The mapping stays valid after the descriptor has been closed.
+    close( fd );
+}
+
+mapped_file::~mapped_file()
+{
+    if( mapped ) {
+        munmap( const_cast<char *>( contents ), length );
+    }
+}
+#endif
+
 namespace {
 
 //TODO move elsewhere.
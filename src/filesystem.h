@@ -12,6 +12,38 @@ bool remove_file( const std::string &path );
 // Rename a file, overriding the target!
 bool rename_file( const std::string &old_path, const std::string &new_path );
 
+/**
+ * Read-only contents of a whole file. The file is memory mapped where the platform
+ * supports it, otherwise it is read into memory. The contents stay valid as long as
+ * the object exists.
+ */
+class mapped_file
+{
+    public:
+        /** Opens the file, @ref is_open tells whether that worked. */
+        mapped_file( const std::string &path );
+        ~mapped_file();
+        mapped_file( const mapped_file & ) = delete;
+        mapped_file &operator=( const mapped_file & ) = delete;
+
+        bool is_open() const {
+            return opened;
+        }
+        const char *data() const {
+            return contents;
+        }
+        size_t size() const {
+            return length;
+        }
+
+    private:
+        const char *contents = "";
+        size_t length = 0;
+        bool opened = false;
+        bool mapped = false;
+        std::vector<char> buffer;
+};
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Returns a vector of files or directories matching pattern at @p root_path.
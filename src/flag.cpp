@@ -4,8 +4,10 @@
 
 #include <map>
 #include <algorithm>
+#include <unordered_map>
 
 std::map<std::string, json_flag> json_flags_all;
+static std::unordered_map<std::string, interned_flag> interned_flags;
 
 const json_flag &json_flag::get( const std::string &id )
 {
@@ -22,6 +24,11 @@ void json_flag::load( JsonObject &jo )
     jo.read( "info", f.info_ );
     jo.read( "conflicts", f.conflicts_ );
     jo.read( "inherit", f.inherit_ );
+
+    const auto iter = interned_flags.find( id );
+    if( iter != interned_flags.end() ) {
+        iter->second.inherit = f.inherit_;
+    }
 }
 
 void json_flag::check_consistency()
@@ -43,4 +50,20 @@ void json_flag::check_consistency()
 void json_flag::reset()
 {
     json_flags_all.clear();
+    interned_flags.clear();
+}
+
+const interned_flag &interned_flag::get( const std::string &id )
+{
+    const auto iter = interned_flags.find( id );
+    if( iter != interned_flags.end() ) {
+        return iter->second;
+    }
+    const interned_flag flag{ static_cast<int>( interned_flags.size() ), json_flag::get( id ).inherit() };
+    return interned_flags.emplace( id, flag ).first->second;
+}
+
+size_t interned_flag::count()
+{
+    return interned_flags.size();
 }
@@ -51,4 +51,20 @@ class json_flag
         static void reset();
 };
 
+/**
+ * Item flags interned to dense indices, so sets of flags can be kept as bit vectors (see
+ * itype::has_flag_index). Any flag string gets an index, whether it's defined in JSON or not.
+ * The indices are valid until json_flag::reset.
+ */
+struct interned_flag {
+    int index;
+    /** Cached json_flag::inherit of the flag. */
+    bool inherit;
+
+    /** Returns the interned flag, a new flag gets the next free index. */
+    static const interned_flag &get( const std::string &id );
+    /** Number of interned flags, one more than the largest index. */
+    static size_t count();
+};
+
 #endif
@@ -167,6 +167,32 @@ const efftype_id effect_tied( "tied" );
 const efftype_id effect_visuals( "visuals" );
 const efftype_id effect_winded( "winded" );
 
+const trait_id trait_CANNIBAL( "CANNIBAL" );
+const trait_id trait_CLUMSY( "CLUMSY" );
+const trait_id trait_DEBUG_NIGHTVISION( "DEBUG_NIGHTVISION" );
+const trait_id trait_DEBUG_NOSCENT( "DEBUG_NOSCENT" );
+const trait_id trait_DEBUG_SILENT( "DEBUG_SILENT" );
+const trait_id trait_HYPEROPIC( "HYPEROPIC" );
+const trait_id trait_ILLITERATE( "ILLITERATE" );
+const trait_id trait_INCONSPICUOUS( "INCONSPICUOUS" );
+const trait_id trait_INFIMMUNE( "INFIMMUNE" );
+const trait_id trait_INFRESIST( "INFRESIST" );
+const trait_id trait_LEG_TENTACLES( "LEG_TENTACLES" );
+const trait_id trait_LEG_TENT_BRACE( "LEG_TENT_BRACE" );
+const trait_id trait_LIGHTSTEP( "LIGHTSTEP" );
+const trait_id trait_M_DEFENDER( "M_DEFENDER" );
+const trait_id trait_PARKOUR( "PARKOUR" );
+const trait_id trait_PER_SLIME( "PER_SLIME" );
+const trait_id trait_PER_SLIME_OK( "PER_SLIME_OK" );
+const trait_id trait_PRED2( "PRED2" );
+const trait_id trait_PRED3( "PRED3" );
+const trait_id trait_PRED4( "PRED4" );
+const trait_id trait_PSYCHOPATH( "PSYCHOPATH" );
+const trait_id trait_SELFAWARE( "SELFAWARE" );
+const trait_id trait_VINES2( "VINES2" );
+const trait_id trait_VINES3( "VINES3" );
+const trait_id trait_WEB_RAPPEL( "WEB_RAPPEL" );
+
 void advanced_inv(); // player_activity.cpp
 void intro();
 
@@ -247,6 +273,7 @@ game::game() :
     user_action_counter(0),
     lookHeight(13),
     tileset_zoom(16),
+    seed(0),
     weather_override( WEATHER_NULL )
 {
     world_generator.reset( new worldfactory() );
@@ -713,10 +740,17 @@ void game::reenter_fullscreen(void)
  */
 void game::setup()
 {
-    popup_status( _( "Please wait while the world data loads..." ), _( "Loading core data" ) );
-    load_core_data();
+    // Going back to the main menu and loading a world with the same mods, options and
+    // artifacts would load exactly the same data again.
+    auto &loader = DynamicDataLoader::get_instance();
+    const std::string data_key = world_data_key( world_generator->active_world );
+    if( data_key.empty() || data_key != loader.get_loaded_key() ) {
+        popup_status( _( "Please wait while the world data loads..." ), _( "Loading core data" ) );
+        load_core_data();
 
-    load_world_modfiles(world_generator->active_world);
+        load_world_modfiles( world_generator->active_world, data_key );
+        loader.set_loaded_key( data_key );
+    }
 
     m =  map( get_world_option<bool>( "ZLEVELS" ) );
 
@@ -771,6 +805,9 @@ special_game_id game::gametype() const
 
 void game::load_map( tripoint pos_sm )
 {
+    if( get_option<bool>( "PREFETCH_SUBMAPS" ) ) {
+        m.prefetch_map_area( pos_sm );
+    }
     m.load( pos_sm.x, pos_sm.y, pos_sm.z, true );
 }
 
@@ -1038,7 +1075,7 @@ bool game::cleanup_at_end()
 
         if (u.has_amount("holybook_bible1", 1) || u.has_amount("holybook_bible2", 1) ||
             u.has_amount("holybook_bible3", 1)) {
-            if (!(u.has_trait("CANNIBAL") || u.has_trait("PSYCHOPATH"))) {
+            if (!(u.has_trait( trait_CANNIBAL ) || u.has_trait( trait_PSYCHOPATH ))) {
                 vRip.push_back("               _______  ___");
                 vRip.push_back("              <       `/   |");
                 vRip.push_back("               >  _     _ (");
@@ -1291,7 +1328,8 @@ static int veh_lumi( vehicle &veh )
 
 void game::calc_driving_offset(vehicle *veh)
 {
-    if (veh == nullptr || !get_option<bool>( "DRIVING_VIEW_OFFSET" ) ) {
+    static const cached_option<bool> driving_view_offset_enabled( "DRIVING_VIEW_OFFSET" );
+    if( veh == nullptr || !driving_view_offset_enabled.get() ) {
         set_driving_view_offset(point(0, 0));
         return;
     }
@@ -1427,22 +1465,36 @@ bool game::do_turn()
         // make them spawn in invisible areas only.
         m.spawn_monsters( false );
     }
+    if( calendar::once_every( MINUTES( 10 ) ) ) {
+        overmap_buffer.process_abstract();
+    }
 
     u.update_body();
 
+    // Options read each turn.
+    static const cached_option<bool> autosave_enabled( "AUTOSAVE" );
+    static const cached_option<int> autosave_turns( "AUTOSAVE_TURNS" );
+    static const cached_option<int> submap_memory_budget( "SUBMAP_MEMORY_BUDGET" );
+    static const cached_option<bool> force_redraw( "FORCE_REDRAW" );
+
     // Auto-save if autosave is enabled
-    if (get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every(get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    if( autosave_enabled.get() &&
+        calendar::once_every( autosave_turns.get() ) &&
         !u.is_dead_state()) {
         autosave();
     }
 
+    // Unload map data far behind the player, long trips would otherwise fill up the memory.
+    if( calendar::once_every( MINUTES( 1 ) ) ) {
+        MAPBUFFER.enforce_memory_budget( size_t( submap_memory_budget.get() ) * 1024 * 1024 );
+    }
+
     update_weather();
     reset_light_level();
 
     // The following happens when we stay still; 10/40 minutes overdue for spawn
-    if ((!u.has_trait("INCONSPICUOUS") && calendar::turn > nextspawn + 100) ||
-        (u.has_trait("INCONSPICUOUS") && calendar::turn > nextspawn + 400)) {
+    if ((!u.has_trait( trait_INCONSPICUOUS ) && calendar::turn > nextspawn + 100) ||
+        (u.has_trait( trait_INCONSPICUOUS ) && calendar::turn > nextspawn + 400)) {
         spawn_mon(-1 + 2 * rng(0, 1), -1 + 2 * rng(0, 1));
         nextspawn = calendar::turn;
     }
@@ -1501,7 +1553,7 @@ bool game::do_turn()
 
     // No-scent debug mutation has to be processed here or else it takes time to start working
     if( !u.has_active_bionic( "bio_scent_mask" ) &&
-        !u.has_trait( "DEBUG_NOSCENT" ) ) {
+        !u.has_trait( trait_DEBUG_NOSCENT ) ) {
         scent.set( u.pos(), u.scent );
         overmap_buffer.set_scent( u.global_omt_location(),  u.scent );
     }
@@ -1539,7 +1591,7 @@ bool game::do_turn()
     monmove();
     update_stair_monsters();
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( u.moves < 0 && force_redraw.get() ) {
         draw();
         refresh_display();
     }
@@ -1595,9 +1647,9 @@ void game::rustCheck()
         }
 
         if (aSkill.is_combat_skill() &&
-            ((u.has_trait("PRED2") && one_in(4)) ||
-             (u.has_trait("PRED3") && one_in(2)) ||
-             (u.has_trait("PRED4") && x_in_y(2, 3)))) {
+            ((u.has_trait( trait_PRED2 ) && one_in(4)) ||
+             (u.has_trait( trait_PRED3 ) && one_in(2)) ||
+             (u.has_trait( trait_PRED4 ) && x_in_y(2, 3)))) {
             // Their brain is optimized to remember this
             if (one_in(15600)) {
                 // They've already passed the roll to avoid rust at
@@ -3702,31 +3754,69 @@ void game::load(std::string worldname, std::string name)
     draw();
 }
 
-void game::load_world_modfiles(WORLDPTR world)
+void game::normalize_mod_order( std::vector<std::string> &mods )
+{
+    // remove any duplicates whilst preserving order (fixes #19385)
+    std::set<std::string> found;
+    mods.erase( std::remove_if( mods.begin(), mods.end(), [&found]( const std::string &e ) {
+        if( found.count( e ) ) {
+            return true;
+        } else {
+            found.insert( e );
+            return false;
+        }
+    } ), mods.end() );
+
+    // require at least one core mod (saves before version 6 may implicitly require dda pack)
+    if( std::none_of( mods.begin(), mods.end(), []( const std::string &e ) {
+        return world_generator->get_mod_manager()->mod_map[e]->core;
+    } ) ) {
+        mods.insert( mods.begin(), "dda" );
+    }
+}
+
+std::string game::world_data_key( WORLDPTR world )
+{
+#ifdef LUA
+    // Lua scripts keep their own state, they must run again for each game.
+    return std::string();
+#else
+    if( !world ) {
+        return std::string();
+    }
+    normalize_mod_order( world->active_mod_order );
+    std::ostringstream key;
+    key << DynamicDataLoader::fingerprint_path( FILENAMES[ "jsondir" ] );
+    const mod_manager *mm = world_generator->get_mod_manager();
+    for( const auto &e : world->active_mod_order ) {
+        if( mm->has_mod( e ) ) {
+            key << ' ' << e << '=' << DynamicDataLoader::fingerprint_path( mm->mod_map.at( e )->path );
+        }
+    }
+    key << " custom=" << DynamicDataLoader::fingerprint_path( world->world_path + "/mods" );
+    key << " artifacts=" << DynamicDataLoader::fingerprint_path( world->world_path + "/artifacts.gsav" );
+    // Names and descriptions are translated while loading.
+    key << " lang=" << get_option<std::string>( "USE_LANG" );
+    // Some options are applied while loading, e.g. monster speed.
+    std::map<std::string, std::string> options;
+    for( const auto &opt : world->WORLD_OPTIONS ) {
+        options[opt.first] = opt.second.getValue();
+    }
+    for( const auto &opt : options ) {
+        key << ' ' << opt.first << '=' << opt.second;
+    }
+    return key.str();
+#endif
+}
+
+void game::load_world_modfiles( WORLDPTR world, const std::string &data_key )
 {
     erase();
     refresh();
 
     if( world ) {
         auto &mods = world->active_mod_order;
-
-        // remove any duplicates whilst preserving order (fixes #19385)
-        std::set<std::string> found;
-        mods.erase( std::remove_if( mods.begin(), mods.end(), [&found]( const std::string &e ) {
-            if( found.count( e ) ) {
-                return true;
-            } else {
-                found.insert( e );
-                return false;
-            }
-        } ), mods.end() );
-
-        // require at least one core mod (saves before version 6 may implicitly require dda pack)
-        if( std::none_of( mods.begin(), mods.end(), []( const std::string &e ) {
-            return world_generator->get_mod_manager()->mod_map[e]->core;
-        } ) ) {
-            mods.insert( mods.begin(), "dda" );
-        }
+        normalize_mod_order( mods );
 
         load_artifacts(world->world_path + "/artifacts.gsav");
         // this code does not care about mod dependencies,
@@ -3744,7 +3834,7 @@ void game::load_world_modfiles(WORLDPTR world)
     refresh();
     popup_status( _( "Please wait while the world data loads..." ), _( "Finalizing and verifying" ) );
 
-    DynamicDataLoader::get_instance().finalize_loaded_data();
+    DynamicDataLoader::get_instance().finalize_loaded_data( data_key );
 }
 
 bool game::load_packs( const std::string &msg, const std::vector<std::string>& packs )
@@ -4055,6 +4145,7 @@ void game::debug()
                        _( "Overmap editor" ),         // 30
                        _( "Draw benchmark (5 seconds)" ),    // 31
                        _( "Teleport - Adjacent overmap" ),   // 32
+                       _( "Show map buffer statistics" ),    // 33
                        _( "Cancel" ),
                        NULL );
     int veh_num;
@@ -4078,7 +4169,7 @@ void game::debug()
             for( int i = 0; i < OMAPX; i++ ) {
                 for( int j = 0; j < OMAPY; j++ ) {
                     for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
-                        cur_om.seen( i, j, k ) = true;
+                        cur_om.set_seen( i, j, k, true );
                     }
                 }
             }
@@ -4408,6 +4499,14 @@ void game::debug()
         case 32:
             debug_menu::teleport_overmap();
             break;
+
+        case 33:
+            popup( _( "Resident submaps: %d\nEstimated memory: %d KB (budget: %d MB)\n"
+                      "Submaps unloaded to stay within budget: %d\nQuads read ahead: %d" ),
+                   int( MAPBUFFER.resident_count() ), int( MAPBUFFER.resident_bytes() / 1024 ),
+                   get_option<int>( "SUBMAP_MEMORY_BUDGET" ), int( MAPBUFFER.evicted_count() ),
+                   int( MAPBUFFER.prefetched_count() ) );
+            break;
     }
     erase();
     refresh_all();
@@ -5106,7 +5205,8 @@ void game::draw_ter( const tripoint &center, const bool looking, const bool draw
 
 tripoint game::get_veh_dir_indicator_location( bool next ) const
 {
-    if( !get_option<bool>( "VEHICLE_DIR_INDICATOR" ) ) {
+    static const cached_option<bool> vehicle_dir_indicator( "VEHICLE_DIR_INDICATOR" );
+    if( !vehicle_dir_indicator.get() ) {
         return tripoint_min;
     }
     vehicle *veh = m.veh_at( u.pos() );
@@ -5150,7 +5250,7 @@ void game::draw_HP()
     int hpy = wide ? 0 : 1;
     int dy = wide ? 1 : 2;
 
-    bool const is_self_aware = u.has_trait("SELFAWARE");
+    bool const is_self_aware = u.has_trait( trait_SELFAWARE );
 
     for (int i = 0; i < num_hp_parts; i++) {
         auto const &hp = get_hp_bar(u.hp_cur[i], u.hp_max[i]);
@@ -5505,7 +5605,8 @@ faction *game::faction_by_ident(std::string id)
 
 Creature *game::is_hostile_nearby()
 {
-    int distance = (get_option<int>( "SAFEMODEPROXIMITY" ) <= 0) ? MAX_VIEW_DISTANCE : get_option<int>( "SAFEMODEPROXIMITY" );
+    static const cached_option<int> safemode_proximity( "SAFEMODEPROXIMITY" );
+    const int distance = safemode_proximity.get() <= 0 ? MAX_VIEW_DISTANCE : safemode_proximity.get();
     return is_hostile_within(distance);
 }
 
@@ -5553,7 +5654,9 @@ int game::mon_info(WINDOW *w)
     const int startrow = use_narrow_sidebar() ? 1 : 0;
 
     int newseen = 0;
-    const int iProxyDist = (get_option<int>( "SAFEMODEPROXIMITY" ) <= 0) ? MAX_VIEW_DISTANCE : get_option<int>( "SAFEMODEPROXIMITY" );
+    static const cached_option<int> safemode_proximity( "SAFEMODEPROXIMITY" );
+    static const cached_option<int> autosafemode_turns( "AUTOSAFEMODETURNS" );
+    const int iProxyDist = safemode_proximity.get() <= 0 ? MAX_VIEW_DISTANCE : safemode_proximity.get();
     // 7 0 1    unique_types uses these indices;
     // 6 8 2    0-7 are provide by direction_from()
     // 5 4 3    8 is used for local monsters (for when we explain them below)
@@ -5691,7 +5794,7 @@ int game::mon_info(WINDOW *w)
             if (!new_seen_mon.empty()) {
                 monster &critter = critter_tracker->find(new_seen_mon.back());
                 cancel_activity_query(_("%s spotted!"), critter.name().c_str());
-                if (u.has_trait("M_DEFENDER") && critter.type->in_species( PLANT )) {
+                if (u.has_trait( trait_M_DEFENDER ) && critter.type->in_species( PLANT )) {
                     add_msg(m_warning, _("We have detected a %s."), critter.name().c_str());
                     if (!u.has_effect( effect_adrenaline_mycus)){
                         u.add_effect( effect_adrenaline_mycus, 300 );
@@ -5715,7 +5818,7 @@ int game::mon_info(WINDOW *w)
         }
     } else if (autosafemode && newseen == 0) { // Auto-safe mode
         turnssincelastmon++;
-        if (turnssincelastmon >= get_option<int>( "AUTOSAFEMODETURNS" ) && safe_mode == SAFE_MODE_OFF) {
+        if (turnssincelastmon >= autosafemode_turns.get() && safe_mode == SAFE_MODE_OFF) {
             set_safe_mode( SAFE_MODE_ON );
         }
     }
@@ -5732,13 +5835,16 @@ int game::mon_info(WINDOW *w)
     // 6 8 2    0-7 are provide by direction_from()
     // 5 4 3    8 is used for local monsters (for when we explain them below)
 
-    const char *dir_labels[] = {
-        _("North:"), _("NE:"), _("East:"), _("SE:"),
-        _("South:"), _("SW:"), _("West:"), _("NW:")
+    // Drawn every turn, translated (and measured) only once.
+    static const cached_translation dir_labels[] = {
+        cached_translation( gettext_noop( "North:" ) ), cached_translation( gettext_noop( "NE:" ) ),
+        cached_translation( gettext_noop( "East:" ) ), cached_translation( gettext_noop( "SE:" ) ),
+        cached_translation( gettext_noop( "South:" ) ), cached_translation( gettext_noop( "SW:" ) ),
+        cached_translation( gettext_noop( "West:" ) ), cached_translation( gettext_noop( "NW:" ) )
     };
     int widths[8];
     for (int i = 0; i < 8; i++) {
-        widths[i] = utf8_width(dir_labels[i]);
+        widths[i] = dir_labels[i].width();
     }
     int xcoords[8];
     const int ycoords[] = { 0, 0, 1, 2, 2, 2, 1, 0 };
@@ -5746,11 +5852,11 @@ int game::mon_info(WINDOW *w)
     xcoords[1] = xcoords[3] = xcoords[2] = (width / 3) * 2;
     xcoords[5] = xcoords[6] = xcoords[7] = 0;
     //for the alignment of the 1,2,3 rows on the right edge
-    xcoords[2] -= utf8_width(_("East:")) - utf8_width(_("NE:"));
+    xcoords[2] -= widths[2] - widths[1];
     for (int i = 0; i < 8; i++) {
         nc_color c = unique_types[i].empty() && unique_mons[i].empty() ? c_dkgray
                      : (dangerous[i] ? c_ltred : c_ltgray);
-        mvwprintz(w, ycoords[i] + startrow, xcoords[i], c, dir_labels[i]);
+        mvwprintz(w, ycoords[i] + startrow, xcoords[i], c, dir_labels[i].c_str());
     }
 
     // Print the symbols of all monsters in all directions.
@@ -5963,11 +6069,13 @@ void game::monmove()
             m.creature_in_field( critter );
         }
 
+        // The bionic is checked last, it's the most expensive check and most monsters
+        // are not close enough anyway.
         if (!critter.is_dead() &&
-            u.has_active_bionic("bio_alarm") &&
             u.power_level >= 25 &&
             rl_dist( u.pos(), critter.pos() ) <= 5 &&
-            !critter.is_hallucination()) {
+            !critter.is_hallucination() &&
+            u.has_active_bionic("bio_alarm")) {
                 u.charge_power(-25);
                 add_msg(m_warning, _("Your motion alarm goes off!"));
                 cancel_activity_query(_("Your motion alarm goes off!"));
@@ -6045,11 +6153,11 @@ void game::flashbang( const tripoint &p, bool player_immune)
         }
         if( m.sees( u.pos(), p, 8 ) ) {
             int flash_mod = 0;
-            if( u.has_trait( "PER_SLIME" ) ) {
+            if( u.has_trait( trait_PER_SLIME ) ) {
                 if (one_in(2)) {
                     flash_mod = 3; // Yay, you weren't looking!
                 }
-            } else if( u.has_trait( "PER_SLIME_OK" ) ) {
+            } else if( u.has_trait( trait_PER_SLIME_OK ) ) {
                 flash_mod = 8; // Just retract those and extrude fresh eyes
             } else if( u.has_bionic( "bio_sunglasses" ) || u.is_wearing( "rm13_armor_on" ) ) {
                 flash_mod = 6;
@@ -6098,7 +6206,7 @@ void game::shockwave( const tripoint &p, int radius, int force, int stun, int da
         }
     }
     if( rl_dist(u.pos(), p ) <= radius && !ignore_player &&
-          (!u.has_trait( "LEG_TENT_BRACE" ) || u.footwear_factor() == 1 ||
+          (!u.has_trait( trait_LEG_TENT_BRACE ) || u.footwear_factor() == 1 ||
           (u.footwear_factor() == .5 && one_in( 2 ) ) ) ) {
         add_msg( m_bad, _("You're caught in the shockwave!") );
         knockback( p, u.pos(), force, stun, dam_mult);
@@ -6253,7 +6361,7 @@ void game::knockback( std::vector<tripoint> &traj, int force, int stun, int dam_
                                 targ->name.c_str());
                     }
                 } else if (u.posx() == traj.front().x && u.posy() == traj.front().y &&
-                           (u.has_trait("LEG_TENT_BRACE") && (!u.footwear_factor() ||
+                           (u.has_trait( trait_LEG_TENT_BRACE ) && (!u.footwear_factor() ||
                             (u.footwear_factor() == .5 && one_in(2))))) {
                     add_msg(_("%s collided with you, and barely dislodges your tentacles!"), targ->name.c_str());
                     force_remaining = 1;
@@ -6348,7 +6456,7 @@ void game::knockback( std::vector<tripoint> &traj, int force, int stun, int dam_
 
 void game::use_computer( const tripoint &p )
 {
-    if (u.has_trait("ILLITERATE")) {
+    if (u.has_trait( trait_ILLITERATE )) {
         add_msg(m_info, _("You can not read a computer screen!"));
         return;
     }
@@ -6357,7 +6465,7 @@ void game::use_computer( const tripoint &p )
         add_msg( m_info, _( "You can not see a computer screen!" ) );
         return;
     }
-    if (u.has_trait("HYPEROPIC") && !u.is_wearing("glasses_reading")
+    if (u.has_trait( trait_HYPEROPIC ) && !u.is_wearing("glasses_reading")
         && !u.is_wearing("glasses_bifocal") && !u.has_effect( effect_contacts)) {
         add_msg(m_info, _("You'll need to put on reading glasses before you can see the screen."));
         return;
@@ -8539,7 +8647,7 @@ tripoint game::look_around( WINDOW *w_info, const tripoint &start_point,
     bVMonsterLookFire = false;
     // TODO: Make this `true`
     const bool allow_zlev_move = m.has_zlevels() &&
-        ( debug_mode || fov_3d || u.has_trait( "DEBUG_NIGHTVISION" ) );
+        ( debug_mode || fov_3d || u.has_trait( trait_DEBUG_NIGHTVISION ) );
 
     temp_exit_fullscreen();
 
@@ -11710,7 +11818,7 @@ bool game::walk_move( const tripoint &dest_loc )
 
     // Print a message if movement is slow
     const int mcost_to = m.move_cost( dest_loc ); //calculate this _after_ calling grabbed_move
-    const bool slowed = ( !u.has_trait( "PARKOUR" ) && ( mcost_to > 2 || mcost_from > 2 ) ) ||
+    const bool slowed = ( !u.has_trait( trait_PARKOUR ) && ( mcost_to > 2 || mcost_from > 2 ) ) ||
                   mcost_to > 4 || mcost_from > 4;
     if( slowed ) {
         // Unless u.pos() has a higher movecost than dest_loc, state that dest_loc is the cause
@@ -11732,7 +11840,7 @@ bool game::walk_move( const tripoint &dest_loc )
         sfx::play_variant_sound( "plmove", "clear_obstacle", sfx::get_heard_volume(u.pos()) );
     }
 
-    if( u.has_trait( "LEG_TENT_BRACE" ) && ( !u.footwear_factor() ||
+    if( u.has_trait( trait_LEG_TENT_BRACE ) && ( !u.footwear_factor() ||
                                              ( u.footwear_factor() == .5 && one_in( 2 ) ) ) ) {
         // DX and IN are long suits for Cephalopods,
         // so this shouldn't cause too much hardship
@@ -11747,12 +11855,12 @@ bool game::walk_move( const tripoint &dest_loc )
         }
     }
 
-    if( !u.has_artifact_with( AEP_STEALTH ) && !u.has_trait( "DEBUG_SILENT" ) ) {
-        if( !u.has_trait( "LEG_TENTACLES" ) ) {
-            if( u.has_trait("LIGHTSTEP") || u.is_wearing( "rm13_armor_on" ) ) {
+    if( !u.has_artifact_with( AEP_STEALTH ) && !u.has_trait( trait_DEBUG_SILENT ) ) {
+        if( !u.has_trait( trait_LEG_TENTACLES ) ) {
+            if( u.has_trait( trait_LIGHTSTEP ) || u.is_wearing( "rm13_armor_on" ) ) {
                 sounds::sound( dest_loc, 2, "", true, "none", "none" );    // Sound of footsteps may awaken nearby monsters
                 sfx::do_footstep();
-            } else if( u.has_trait( "CLUMSY" ) ) {
+            } else if( u.has_trait( trait_CLUMSY ) ) {
                 sounds::sound( dest_loc, 10, "", true, "none", "none" );
                 sfx::do_footstep();
             } else if( u.has_bionic( "bio_ankles" ) ) {
@@ -11813,16 +11921,16 @@ void game::place_player( const tripoint &dest_loc )
     }
     ///\EFFECT_DEX increases chance of avoiding cuts on sharp terrain
     if( m.has_flag("SHARP", dest_loc) && !one_in(3) && !x_in_y(1+u.dex_cur/2, 40) &&
-        (!u.in_vehicle) && (!u.has_trait("PARKOUR") || one_in(4)) ) {
+        (!u.in_vehicle) && (!u.has_trait( trait_PARKOUR ) || one_in(4)) ) {
         body_part bp = random_body_part();
         if(u.deal_damage( nullptr, bp, damage_instance( DT_CUT, rng( 1, 10 ) ) ).total_damage() > 0) {
             //~ 1$s - bodypart name in accusative, 2$s is terrain name.
             add_msg(m_bad, _("You cut your %1$s on the %2$s!"),
                     body_part_name_accusative(bp).c_str(),
                     m.has_flag_ter( "SHARP", dest_loc ) ? m.tername(dest_loc).c_str() : m.furnname(dest_loc).c_str() );
-            if ((u.has_trait("INFRESIST")) && (one_in(1024))) {
+            if ((u.has_trait( trait_INFRESIST )) && (one_in(1024))) {
             u.add_effect( effect_tetanus, 1, num_bp, true);
-            } else if ((!u.has_trait("INFIMMUNE") || !u.has_trait("INFRESIST")) && (one_in(256))) {
+            } else if ((!u.has_trait( trait_INFIMMUNE ) || !u.has_trait( trait_INFRESIST )) && (one_in(256))) {
               u.add_effect( effect_tetanus, 1, num_bp, true);
              }
         }
@@ -11864,8 +11972,11 @@ void game::place_player( const tripoint &dest_loc )
     // and dest_loc was not adjusted and therefor is still in the un-shifted system and probably wrong.
 
     //Autopickup
-    if (get_option<bool>( "AUTO_PICKUP" ) && (!get_option<bool>( "AUTO_PICKUP_SAFEMODE" ) || mostseen == 0) &&
-        ( m.has_items( u.pos() ) || get_option<bool>( "AUTO_PICKUP_ADJACENT" ) ) ) {
+    static const cached_option<bool> auto_pickup( "AUTO_PICKUP" );
+    static const cached_option<bool> auto_pickup_safemode( "AUTO_PICKUP_SAFEMODE" );
+    static const cached_option<bool> auto_pickup_adjacent( "AUTO_PICKUP_ADJACENT" );
+    if( auto_pickup.get() && ( !auto_pickup_safemode.get() || mostseen == 0 ) &&
+        ( m.has_items( u.pos() ) || auto_pickup_adjacent.get() ) ) {
         Pickup::pick_up(u.pos(), -1);
     }
 
@@ -12520,7 +12631,8 @@ void game::fling_creature(Creature *c, const int &dir, float flvel, bool control
     int steps = 0;
     const bool is_u = (c == &u);
     // Don't animate critters getting bashed if animations are off
-    const bool animate = is_u || get_option<bool>( "ANIMATIONS" );
+    static const cached_option<bool> animations( "ANIMATIONS" );
+    const bool animate = is_u || animations.get();
 
     player *p = dynamic_cast<player*>(c);
 
@@ -12993,7 +13105,7 @@ tripoint game::find_or_make_stairs( map &mp, const int z_after, bool &rope_ladde
         return tripoint_min;
     }
 
-    if( u.has_trait( "WEB_RAPPEL" ) ) {
+    if( u.has_trait( trait_WEB_RAPPEL ) ) {
         if (query_yn(_("There is a sheer drop halfway down. Web-descend?"))) {
             rope_ladder = true;
             if ((rng(4, 8)) < u.get_skill_level( skill_dodge )) {
@@ -13004,9 +13116,9 @@ tripoint game::find_or_make_stairs( map &mp, const int z_after, bool &rope_ladde
         } else {
             return tripoint_min;
         }
-    } else if (u.has_trait("VINES2") || u.has_trait("VINES3")) {
+    } else if (u.has_trait( trait_VINES2 ) || u.has_trait( trait_VINES3 )) {
         if (query_yn(_("There is a sheer drop halfway down.  Use your vines to descend?"))) {
-            if (u.has_trait("VINES2")) {
+            if (u.has_trait( trait_VINES2 )) {
                 if (query_yn(_("Detach a vine?  It'll hurt, but you'll be able to climb back up..."))) {
                     rope_ladder = true;
                     add_msg(m_bad, _("You descend on your vines, though leaving a part of you behind stings."));
@@ -13068,7 +13180,7 @@ void game::vertical_shift( const int z_after )
         m.access_cache( z_before ).vehicle_list.clear();
         m.set_transparency_cache_dirty( z_before );
         m.set_outside_cache_dirty( z_before );
-        m.load( get_levx(), get_levy(), z_after, true );
+        load_map( tripoint( get_levx(), get_levy(), z_after ) );
         shift_monsters( 0, 0, z_after - z_before );
         reload_npcs();
     } else {
@@ -13160,6 +13272,10 @@ void game::update_map(int &x, int &y)
     // this handles loading/unloading submaps that have scrolled on or off the viewport
     m.shift( shiftx, shifty );
 
+    if( get_option<bool>( "PREFETCH_SUBMAPS" ) ) {
+        prefetch_submaps( shiftx, shifty );
+    }
+
     // Shift monsters
     shift_monsters( shiftx, shifty, 0 );
     u.shift_destination(-shiftx * SEEX, -shifty * SEEY);
@@ -13201,6 +13317,27 @@ void game::update_map(int &x, int &y)
     update_overmap_seen();
 }
 
+void game::prefetch_submaps( const int shiftx, const int shifty )
+{
+    int dx = sgn( shiftx );
+    int dy = sgn( shifty );
+    int distance = 1;
+    const vehicle *veh = u.in_vehicle ? m.veh_at( u.pos() ) : nullptr;
+    if( veh != nullptr && veh->velocity != 0 ) {
+        rl_vec2d dir = veh->move_vec();
+        if( veh->velocity < 0 ) {
+            dir.x = -dir.x;
+            dir.y = -dir.y;
+        }
+        // Anything more than 22.5 degrees off an axis counts as moving along it.
+        dx = dir.x > 0.38 ? 1 : ( dir.x < -0.38 ? -1 : 0 );
+        dy = dir.y > 0.38 ? 1 : ( dir.y < -0.38 ? -1 : 0 );
+        // One more submap row for every 20 mph, fast vehicles cross a submap in a few turns.
+        distance = std::min( 1 + abs( veh->velocity ) / 2000, 4 );
+    }
+    m.prefetch_submaps( dx, dy, distance );
+}
+
 void game::update_overmap_seen()
 {
     const tripoint ompos = u.global_omt_location();
@@ -13384,7 +13521,7 @@ void game::update_stair_monsters()
                 if ((pushx != 0 || pushy != 0) && (mon_at(pos) == -1) &&
                     critter.can_move_to( pos )) {
                     bool resiststhrow = (u.is_throw_immune()) ||
-                                        (u.has_trait("LEG_TENT_BRACE"));
+                                        (u.has_trait( trait_LEG_TENT_BRACE ));
                     if (resiststhrow && one_in(player_throw_resist_chance)) {
                         u.moves -= 25; // small charge for avoiding the push altogether
                         add_msg(_("The %s fails to push you back!"),
@@ -13694,7 +13831,7 @@ void game::nuke( const tripoint &p )
         }
     }
     tmpmap.save();
-    overmap_buffer.ter(x, y, 0) = oter_id( "crater" );
+    overmap_buffer.set_ter( x, y, 0, oter_id( "crater" ) );
     // Kill any npcs on that omap location.
     std::vector<npc *> npcs = overmap_buffer.get_npcs_near_omt(x, y, 0, 0);
     for( auto &npc : npcs ) {
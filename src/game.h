@@ -149,8 +149,16 @@ class game
          */
         bool check_mod_data( const std::vector<std::string> &opts );
 
-        /** Loads core data and mods from the given world. May throw. */
-        void load_world_modfiles(WORLDPTR world);
+        /**
+         * Loads core data and mods from the given world. May throw.
+         * @param data_key See @ref world_data_key, passed on to DynamicDataLoader::finalize_loaded_data.
+         */
+        void load_world_modfiles( WORLDPTR world, const std::string &data_key = std::string() );
+        /**
+         * Identifies the data @ref load_core_data and @ref load_world_modfiles would load
+         * for the world, see DynamicDataLoader::get_loaded_key. Empty if it can't be reused.
+         */
+        std::string world_data_key( WORLDPTR world );
 
         /**
          *  Load content packs
@@ -163,6 +171,8 @@ class game
     protected:
         /** Loads dynamic data from the given directory. May throw. */
         void load_data_from_dir( const std::string &path, const std::string &src );
+        /** Removes duplicates from the world's mod list and makes sure it has a core mod. */
+        static void normalize_mod_order( std::vector<std::string> &mods );
 
 
         // May be a bit hacky, but it's probably better than the header spaghetti
@@ -423,6 +433,9 @@ class game
         // Helper to make calling with a player pointer less verbose.
         void update_map( player &p );
         void update_map(int &x, int &y);
+        // Reads the submaps ahead of the player from disk in the background, the
+        // direction comes from the controlled vehicle or the last map shift.
+        void prefetch_submaps( int shiftx, int shifty );
         void update_overmap_seen(); // Update which overmap tiles we can see
 
         void process_artifact(item *it, player *p);
@@ -2,6 +2,7 @@
 
 #include "json.h"
 #include "filesystem.h"
+#include "cata_utility.h"
 
 // can load from json
 #include "flag.h"
@@ -58,12 +59,22 @@
 #include "npc_class.h"
 #include "recipe_dictionary.h"
 #include "harvest.h"
+#include "get_version.h"
 
 #include <string>
 #include <vector>
 #include <fstream>
 #include <sstream> // for throwing errors
 #include <locale> // for loading names
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#if ((defined _WIN32 || defined WINDOWS) && !defined _MSC_VER)
+#   include "mingw.thread.h"
+#endif
 
 DynamicDataLoader::DynamicDataLoader()
 {
@@ -241,16 +252,30 @@ void DynamicDataLoader::initialize()
     add( "harvest", []( JsonObject &jo, const std::string &src ) { harvest_list::load( jo, src ); } );
 }
 
-void DynamicDataLoader::load_data_from_path( const std::string &path, const std::string &src )
+/**
+ * A json data file split into its top level objects, see DynamicDataLoader::load_data_from_path.
+ * The objects refer to the stream, which refers to the file contents.
+ */
+struct indexed_json_file {
+    std::string path;
+    std::unique_ptr<mapped_file> contents;
+    std::unique_ptr<imemstream> stream;
+    std::unique_ptr<JsonIn> jsin;
+    std::vector<JsonObject> objects;
+    /** Message to throw instead of loading the file, because it could not be read or parsed. */
+    std::string error;
+    /** Set when @ref index is done, guarded by the mutex of load_data_from_path. */
+    bool done = false;
+
+    void index( const std::string &file );
+    void release();
+};
+
+/** The files load_data_from_path loads from @p path, in that order. */
+static std::vector<std::string> data_files( const std::string &path )
 {
-    // We assume that each folder is consistent in itself,
-    // and all the previously loaded folders.
-    // E.g. the core might provide a vpart "frame-x"
-    // the first loaded mode might provide a vehicle that uses that frame
-    // But not the other way round.
-
     // get a list of all files in the directory
-    str_vec files = get_files_from_path(".json", path, true, true);
+    std::vector<std::string> files = get_files_from_path(".json", path, true, true);
     if (files.empty()) {
         std::ifstream tmp(path.c_str(), std::ios::in);
         if (tmp) {
@@ -259,25 +284,137 @@ void DynamicDataLoader::load_data_from_path( const std::string &path, const std:
             files.push_back(path);
         }
     }
-    // iterate over each file
-    for( auto &files_i : files ) {
-        const std::string &file = files_i;
-        // open the file as a stream
-        std::ifstream infile(file.c_str(), std::ifstream::in | std::ifstream::binary);
-        // and stuff it into ram
-        std::istringstream iss(
-            std::string(
-                (std::istreambuf_iterator<char>(infile)),
-                std::istreambuf_iterator<char>()
-            )
-        );
-        try {
-            // parse it
-            JsonIn jsin(iss);
-            load_all_from_json( jsin, src );
-        } catch( const JsonError &err ) {
-            throw std::runtime_error( file + ": " + err.what() );
+    return files;
+}
+
+std::string DynamicDataLoader::fingerprint_path( const std::string &path )
+{
+    // 64 bit FNV-1a over the file names and contents.
+    uint64_t hash = 14695981039346656037ull;
+    const auto add = [&hash]( const char *data, const size_t size ) {
+        for( size_t i = 0; i < size; i++ ) {
+            hash ^= static_cast<unsigned char>( data[i] );
+            hash *= 1099511628211ull;
         }
+    };
+    const std::vector<std::string> files = data_files( path );
+    for( const std::string &file : files ) {
+        add( file.c_str(), file.size() + 1 );
+        const mapped_file contents( file );
+        add( contents.data(), contents.size() );
+    }
+    std::ostringstream result;
+    result << std::hex << hash << ':' << std::dec << files.size();
+    return result.str();
+}
+
+void DynamicDataLoader::load_data_from_path( const std::string &path, const std::string &src )
+{
+    // We assume that each folder is consistent in itself,
+    // and all the previously loaded folders.
+    // E.g. the core might provide a vpart "frame-x"
+    // the first loaded mode might provide a vehicle that uses that frame
+    // But not the other way round.
+
+    const str_vec files = data_files( path );
+    // Splitting the files into their objects scans all of the json (the objects index their
+    // members), that is done on worker threads. The objects are then loaded here, in the
+    // original order, as the loaders depend on what has been loaded before.
+    std::vector<indexed_json_file> indexed( files.size() );
+    std::mutex mutex;
+    std::condition_variable indexed_one;
+    std::atomic<size_t> next_file( 0 );
+    const auto work = [&]() {
+        for( size_t i = next_file++; i < files.size(); i = next_file++ ) {
+            indexed[i].index( files[i] );
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                indexed[i].done = true;
+            }
+            indexed_one.notify_all();
+        }
+    };
+    const size_t worker_count = std::min<size_t>( std::max( std::thread::hardware_concurrency(), 1u ),
+                                files.size() );
+    std::vector<std::thread> workers;
+    for( size_t i = 0; i < worker_count; i++ ) {
+        workers.emplace_back( work );
+    }
+    const auto join_workers = [&]() {
+        for( auto &worker : workers ) {
+            worker.join();
+        }
+    };
+
+    try {
+        for( auto &file : indexed ) {
+            {
+                std::unique_lock<std::mutex> lock( mutex );
+                indexed_one.wait( lock, [&file]() {
+                    return file.done;
+                } );
+            }
+            if( !file.error.empty() ) {
+                throw std::runtime_error( file.error );
+            }
+            try {
+                for( JsonObject &jo : file.objects ) {
+                    load_object( jo, src );
+                    jo.finish();
+                }
+            } catch( const JsonError &err ) {
+                throw std::runtime_error( file.path + ": " + err.what() );
+            }
+            // Free the file early, large mod packs have a lot of json.
+            file.release();
+        }
+    } catch( ... ) {
+        // Let the workers skip the remaining files.
+        next_file = files.size();
+        join_workers();
+        throw;
+    }
+    join_workers();
+}
+
+void indexed_json_file::release()
+{
+    // The objects refer to the stream, and that to the contents.
+    objects.clear();
+    jsin.reset();
+    stream.reset();
+    contents.reset();
+}
+
+void indexed_json_file::index( const std::string &file )
+{
+    path = file;
+    // map the file into memory, parsing can then seek around without touching the disk
+    contents.reset( new mapped_file( file ) );
+    if( !contents->is_open() ) {
+        error = file + ": opening file failed";
+        return;
+    }
+    stream.reset( new imemstream( contents->data(), contents->size() ) );
+    jsin.reset( new JsonIn( *stream ) );
+    try {
+        // Same structure checks as in DynamicDataLoader::load_all_from_json.
+        if( jsin->test_object() ) {
+            objects.push_back( jsin->get_object() );
+            jsin->eat_whitespace();
+            if( jsin->good() ) {
+                jsin->error( string_format( "expected single-object file but found '%c'", jsin->peek() ) );
+            }
+        } else if( jsin->test_array() ) {
+            jsin->start_array();
+            while( !jsin->end_array() ) {
+                objects.push_back( jsin->get_object() );
+            }
+        } else {
+            jsin->error( "expected object or array" );
+        }
+    } catch( const JsonError &err ) {
+        error = file + ": " + err.what();
     }
 }
 
@@ -316,6 +453,7 @@ void init_names()
 
 void DynamicDataLoader::unload_data()
 {
+    loaded_key.clear();
     json_flag::reset();
     requirement_data::reset();
     vitamin::reset();
@@ -367,11 +505,33 @@ void DynamicDataLoader::unload_data()
 }
 
 extern void calculate_mapgen_weights();
-void DynamicDataLoader::finalize_loaded_data()
+/** Keys of data that passed check_consistency without any errors, see finalize_loaded_data. */
+static std::vector<std::string> read_checked_data()
+{
+    std::vector<std::string> result;
+    read_from_file_optional( FILENAMES["checked_data"], [&result]( std::istream & fin ) {
+        std::string line;
+        while( std::getline( fin, line ) ) {
+            result.push_back( line );
+        }
+    } );
+    return result;
+}
+
+/** What is remembered of a data key: the game version (checks change with it) and a hash. */
+static std::string checked_data_entry( const std::string &data_key )
+{
+    std::ostringstream entry;
+    entry << getVersionString() << ' ' << std::hex << std::hash<std::string>()( data_key );
+    return entry.str();
+}
+
+void DynamicDataLoader::finalize_loaded_data( const std::string &data_key )
 {
     item_controller->finalize();
     requirement_data::finalize();
     vpart_info::finalize();
+    emit::finalize();
     set_ter_ids();
     set_furn_ids();
     set_oter_ids();
@@ -387,36 +547,77 @@ void DynamicDataLoader::finalize_loaded_data()
     finalize_constructions();
     npc_class::finalize_all();
     harvest_list::finalize_all();
+
+    // Skipping the checks below is only correct as long as they don't change the data,
+    // except for repairing data they report (that data is never recorded as checked).
+    // Anything the game relies on belongs into the finalize functions above.
+    if( data_key.empty() || !get_option<bool>( "SKIP_CHECKED_DATA" ) ) {
+        check_consistency();
+        return;
+    }
+    std::vector<std::string> checked = read_checked_data();
+    const std::string entry = checked_data_entry( data_key );
+    if( std::find( checked.begin(), checked.end(), entry ) != checked.end() ) {
+        DebugLog( D_INFO, D_MAIN ) << "skipping consistency checks of already checked data";
+        return;
+    }
+    const unsigned int errors_before = debugmsg_count();
     check_consistency();
+    if( debugmsg_count() != errors_before ) {
+        return;
+    }
+    // Only the most recent ones, e.g. for a few worlds with different mods.
+    static const size_t max_checked = 16;
+    checked.push_back( entry );
+    if( checked.size() > max_checked ) {
+        checked.erase( checked.begin(), checked.end() - max_checked );
+    }
+    write_to_file( FILENAMES["checked_data"], [&checked]( std::ostream & fout ) {
+        for( const std::string &e : checked ) {
+            fout << e << '\n';
+        }
+    }, _( "list of checked game data" ) );
 }
 
 void DynamicDataLoader::check_consistency()
 {
-    json_flag::check_consistency();
-    requirement_data::check_consistency();
-    vitamin::check_consistency();
-    emit::check_consistency();
-    activity_type::check_consistency();
-    item_controller->check_definitions();
-    materials::check();
-    fault::check_consistency();
-    vpart_info::check();
-    MonsterGenerator::generator().check_monster_definitions();
-    MonsterGroupManager::check_group_definitions();
-    check_furniture_and_terrain();
-    check_constructions();
-    profession::check_definitions();
-    scenario::check_definitions();
-    check_martialarts();
-    mutation_branch::check_consistency();
-    overmap_terrain::check_consistency();
-    overmap_specials::check_consistency();
-    ammunition_type::check_consistency();
-    trap::check_consistency();
-    check_bionics();
-    gates::check();
-    npc_class::check_consistency();
-    mission_type::check_consistency();
-    item_action_generator::generator().check_consistency();
-    harvest_list::check_consistency();
+    using check_function = std::function<void()>;
+    const std::vector<std::pair<const char *, check_function>> checks = {
+        { "flags", &json_flag::check_consistency },
+        { "requirements", []() { requirement_data::check_consistency(); } },
+        { "vitamins", &vitamin::check_consistency },
+        { "emissions", &emit::check_consistency },
+        { "activities", &activity_type::check_consistency },
+        { "items", []() { item_controller->check_definitions(); } },
+        { "materials", &materials::check },
+        { "faults", &fault::check_consistency },
+        { "vehicle parts", &vpart_info::check },
+        { "monsters", []() { MonsterGenerator::generator().check_monster_definitions(); } },
+        { "monster groups", &MonsterGroupManager::check_group_definitions },
+        { "furniture and terrain", &check_furniture_and_terrain },
+        { "constructions", &check_constructions },
+        { "professions", &profession::check_definitions },
+        { "scenarios", &scenario::check_definitions },
+        { "martial arts", &check_martialarts },
+        { "mutations", &mutation_branch::check_consistency },
+        { "overmap terrain", &overmap_terrain::check_consistency },
+        { "overmap specials", &overmap_specials::check_consistency },
+        { "ammunition types", &ammunition_type::check_consistency },
+        { "traps", &trap::check_consistency },
+        { "bionics", &check_bionics },
+        { "gates", &gates::check },
+        { "npc classes", &npc_class::check_consistency },
+        { "mission types", &mission_type::check_consistency },
+        { "item actions", []() { item_action_generator::generator().check_consistency(); } },
+        { "harvest lists", &harvest_list::check_consistency },
+    };
+    // Each check is timed, so slow ones show up in the debug log.
+    for( const auto &check : checks ) {
+        const auto start = std::chrono::steady_clock::now();
+        check.second();
+        const auto duration = std::chrono::steady_clock::now() - start;
+        DebugLog( D_INFO, D_MAIN ) << "checking " << check.first << " took "
+                                   << std::chrono::duration_cast<std::chrono::milliseconds>( duration ).count()
+                                   << " ms";
+    }
 }
@@ -94,6 +94,8 @@ class DynamicDataLoader
          */
         void check_consistency();
 
+        std::string loaded_key;
+
     public:
         /**
          * Returns the single instance of this class.
@@ -108,19 +110,44 @@ class DynamicDataLoader
          * @throws std::exception on all kind of errors.
          */
         void load_data_from_path( const std::string &path, const std::string &src );
+        /**
+         * Hash of the contents of the files @ref load_data_from_path would load from @p path.
+         * Reading the files is much faster than loading them.
+         */
+        static std::string fingerprint_path( const std::string &path );
         /**
          * Deletes and unloads all the data previously loaded with
          * @ref load_data_from_path
          */
         void unload_data();
+        /**
+         * Identifies the data that is currently loaded, see game::setup. Empty if unknown,
+         * e.g. after @ref unload_data.
+         */
+        const std::string &get_loaded_key() const {
+            return loaded_key;
+        }
+        void set_loaded_key( const std::string &key ) {
+            loaded_key = key;
+        }
+        /**
+         * Must be called when the loaded data is changed after loading, e.g. by
+         * creating artifacts, so it is not mistaken for freshly loaded data.
+         */
+        void loaded_data_changed() {
+            loaded_key.clear();
+        }
         /**
          * Called to finalize the loaded data. This should be called
          * after all the mods have been loaded.
          * It must be called once after loading all data.
          * It also checks the consistency of the loaded data with
          * @ref check_consistency
+         * @param data_key Identifies the loaded data, see game::world_data_key. If the same
+         * data has passed the checks before, they are skipped (unless disabled by the
+         * SKIP_CHECKED_DATA option).
          */
-        void finalize_loaded_data();
+        void finalize_loaded_data( const std::string &data_key = std::string() );
 
         /**
          * Loads and then removes entries from @param data
@@ -2159,9 +2159,10 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
 // MATERIALS-TODO: put this in json
     std::string damtext = "";
 
-    if( ( damage() != 0 || ( get_option<bool>( "ITEM_HEALTH_BAR" ) && is_armor() ) ) && !is_null() && with_prefix ) {
+    static const cached_option<bool> item_health_bar( "ITEM_HEALTH_BAR" );
+    if( ( damage() != 0 || ( item_health_bar.get() && is_armor() ) ) && !is_null() && with_prefix ) {
         if( damage() < 0 )  {
-            if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+            if( item_health_bar.get() ) {
                 damtext = "<color_" + string_from_color( damage_color() ) + ">" + damage_symbol() + " </color>";
 
             } else if (is_gun())  {
@@ -2176,7 +2177,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
                 if (damage() == 3) damtext = pgettext( "damage adjective", "mangled " );
                 if (damage() >= 4) damtext = pgettext( "damage adjective", "pulped " );
 
-            } else if ( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+            } else if( item_health_bar.get() ) {
                 damtext = "<color_" + string_from_color( damage_color() ) + ">" + damage_symbol() + " </color>";
 
             } else {
@@ -2666,9 +2667,10 @@ void item::unset_flags()
 
 bool item::has_flag( const std::string &f ) const
 {
-    bool ret = false;
+    const interned_flag &flag = interned_flag::get( f );
 
-    if( json_flag::get( f ).inherit() ) {
+    // mods are inside the contents, most items have none
+    if( flag.inherit && !contents.empty() ) {
         for( const auto e : is_gun() ? gunmods() : toolmods() ) {
             // gunmods fired separately do not contribute to base gun flags
             if( !e->is_gun() && e->has_flag( f ) ) {
@@ -2678,14 +2680,12 @@ bool item::has_flag( const std::string &f ) const
     }
 
     // other item type flags
-    ret = type->item_tags.count(f);
-    if (ret) {
-        return ret;
+    if( type->has_flag_index( flag.index ) ) {
+        return true;
     }
 
     // now check for item specific flags
-    ret = item_tags.count(f);
-    return ret;
+    return !item_tags.empty() && item_tags.count( f ) > 0;
 }
 
 bool item::has_any_flag( const std::vector<std::string>& flags ) const
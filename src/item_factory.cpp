@@ -347,6 +347,11 @@ void Item_factory::finalize() {
             }
         }
     }
+
+    // the tags don't change anymore
+    for( auto &e : m_templates ) {
+        e.second.finalize_flags();
+    }
 }
 
 void Item_factory::finalize_item_blacklist()
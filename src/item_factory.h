@@ -208,7 +208,10 @@ class Item_factory
          * @param new_type The new item type, must not be null.
          */
         void add_item_type( const itype &def ) {
-            m_runtimes[ def.id ].reset( new itype( def ) );
+            itype *const type = new itype( def );
+            // usually a copy of another type with different tags
+            type->finalize_flags();
+            m_runtimes[ def.id ].reset( type );
         }
 
         /**
@@ -1,4 +1,5 @@
 #include "debug.h"
+#include "flag.h"
 #include "itype.h"
 #include "ammo.h"
 #include "game.h"
@@ -16,6 +17,23 @@ std::string itype::nname( unsigned int const quantity ) const
     return ngettext( name.c_str(), name_plural.c_str(), quantity );
 }
 
+bool itype::has_flag_index( const int index ) const
+{
+    return static_cast<size_t>( index ) < item_tag_bits.size() && item_tag_bits[index];
+}
+
+void itype::finalize_flags()
+{
+    item_tag_bits.clear();
+    for( const std::string &tag : item_tags ) {
+        const size_t tag_index = interned_flag::get( tag ).index;
+        if( tag_index >= item_tag_bits.size() ) {
+            item_tag_bits.resize( tag_index + 1, false );
+        }
+        item_tag_bits[tag_index] = true;
+    }
+}
+
 // Members of iuse struct, which is slowly morphing into a class.
 bool itype::has_use() const
 {
@@ -673,6 +673,13 @@ public:
     std::set<emit_id> emits;
 
     std::set<std::string> item_tags;
+    /**
+     * Whether @ref item_tags contains the flag with the given interned_flag::index. This is
+     * a single bit test on the bits built by @ref finalize_flags.
+     */
+    bool has_flag_index( int index ) const;
+    /** Builds the bits for @ref has_flag_index, call it after changing @ref item_tags. */
+    void finalize_flags();
     std::set<matec_id> techniques;
 
     // Minimum stat(s) or skill(s) to use the item
@@ -801,6 +808,10 @@ public:
     long tick( player *p, item *it, const tripoint &pos ) const;
 
     virtual ~itype() { };
+
+private:
+    /** See @ref has_flag_index. */
+    std::vector<bool> item_tag_bits;
 };
 
 #endif
@@ -12,6 +12,7 @@
 #include <vector>
 #include <bitset>
 #include <iterator>
+#include <algorithm>
 
 // JSON parsing and serialization tools for Cataclysm-DDA.
 // For documentation, see the included header, json.h.
@@ -66,6 +67,12 @@ std::string utf16_to_utf8(uint32_t ch)
  * represents a JSON object,
  * providing access to the underlying data.
  */
+static bool position_name_less( const std::pair<std::string, int> &lhs,
+                                const std::pair<std::string, int> &rhs )
+{
+    return lhs.first < rhs.first;
+}
+
 JsonObject::JsonObject(JsonIn &j) : positions()
 {
     jsin = &j;
@@ -75,16 +82,28 @@ JsonObject::JsonObject(JsonIn &j) : positions()
     while (!jsin->end_object()) {
         std::string n = jsin->get_member_name();
         int p = jsin->tell();
-        if (n != "//" && n != "comment" && positions.count(n) > 0) {
+        positions.emplace_back( std::move( n ), p );
+        jsin->skip_value();
+    }
+    end = jsin->tell();
+    final_separator = jsin->get_ate_separator();
+
+    // Stable, so the last one of duplicated members comes last.
+    std::stable_sort( positions.begin(), positions.end(), position_name_less );
+    for( size_t i = 1; i < positions.size(); ) {
+        if( positions[i - 1].first != positions[i].first ) {
+            i++;
+            continue;
+        }
+        const std::string &n = positions[i].first;
+        if( n != "//" && n != "comment" ) {
             // members with name "//" or "comment" are used for comments and
             // should be ignored anyway.
+            j.seek( positions[i].second );
             j.error("duplicate entry in json object");
         }
-        positions[n] = p;
-        jsin->skip_value();
+        positions.erase( positions.begin() + i - 1 );
     }
-    end = jsin->tell();
-    final_separator = jsin->get_ate_separator();
 }
 
 JsonObject::JsonObject(const JsonObject &jo)
@@ -113,24 +132,57 @@ bool JsonObject::empty()
     return positions.empty();
 }
 
-int JsonObject::verify_position(const std::string &name,
-                                const bool throw_exception)
+int JsonObject::get_position( const char *name, const size_t length ) const
+{
+    // compares against the name in place, no std::string is built for the key
+    const auto iter = std::lower_bound( positions.begin(), positions.end(), name,
+    [length]( const std::pair<std::string, int> &elem, const char *n ) {
+        return elem.first.compare( 0, std::string::npos, n, length ) < 0;
+    } );
+    if( iter == positions.end() || iter->first.compare( 0, std::string::npos, name, length ) != 0 ) {
+        return 0;
+    }
+    return iter->second;
+}
+
+int JsonObject::get_position( const std::string &name ) const
+{
+    return get_position( name.c_str(), name.size() );
+}
+
+int JsonObject::get_position( const char *name ) const
+{
+    return get_position( name, strlen( name ) );
+}
+
+int JsonObject::verify_position( const char *name, const bool throw_exception )
 {
-    int pos = positions[name]; // initialized to 0 if it doesn't exist
+    int pos = get_position( name ); // 0 if it doesn't exist
     if (pos > start) {
         return pos;
     } else if (throw_exception && !jsin) {
         throw JsonError( std::string( "member lookup on empty object: " ) + name );
     } else if (throw_exception) {
         jsin->seek(start);
-        jsin->error("member not found: " + name);
+        jsin->error( std::string( "member not found: " ) + name );
     }
     // 0 is always the opening brace,
     // so it will never indicate a valid member position
     return 0;
 }
 
+int JsonObject::verify_position(const std::string &name,
+                                const bool throw_exception)
+{
+    return verify_position( name.c_str(), throw_exception );
+}
+
 bool JsonObject::has_member(const std::string &name)
+{
+    return has_member( name.c_str() );
+}
+
+bool JsonObject::has_member( const char *name )
 {
     return (bool)verify_position(name, false);
 }
@@ -195,6 +247,11 @@ JsonIn *JsonObject::get_raw(const std::string &name)
 /* returning values by name */
 
 bool JsonObject::get_bool(const std::string &name)
+{
+    return get_bool( name.c_str() );
+}
+
+bool JsonObject::get_bool( const char *name )
 {
     int pos = verify_position(name);
     jsin->seek(pos);
@@ -203,7 +260,12 @@ bool JsonObject::get_bool(const std::string &name)
 
 bool JsonObject::get_bool(const std::string &name, const bool fallback)
 {
-    int pos = positions[name];
+    return get_bool( name.c_str(), fallback );
+}
+
+bool JsonObject::get_bool( const char *name, const bool fallback )
+{
+    int pos = get_position( name );
     if (pos <= start) {
         return fallback;
     }
@@ -212,6 +274,11 @@ bool JsonObject::get_bool(const std::string &name, const bool fallback)
 }
 
 int JsonObject::get_int(const std::string &name)
+{
+    return get_int( name.c_str() );
+}
+
+int JsonObject::get_int( const char *name )
 {
     int pos = verify_position(name);
     jsin->seek(pos);
@@ -220,7 +287,12 @@ int JsonObject::get_int(const std::string &name)
 
 int JsonObject::get_int(const std::string &name, const int fallback)
 {
-    int pos = positions[name];
+    return get_int( name.c_str(), fallback );
+}
+
+int JsonObject::get_int( const char *name, const int fallback )
+{
+    int pos = get_position( name );
     if (pos <= start) {
         return fallback;
     }
@@ -237,7 +309,7 @@ long JsonObject::get_long(const std::string &name)
 
 long JsonObject::get_long(const std::string &name, const long fallback)
 {
-    long pos = positions[name];
+    long pos = get_position( name );
     if (pos <= start) {
         return fallback;
     }
@@ -246,6 +318,11 @@ long JsonObject::get_long(const std::string &name, const long fallback)
 }
 
 double JsonObject::get_float(const std::string &name)
+{
+    return get_float( name.c_str() );
+}
+
+double JsonObject::get_float( const char *name )
 {
     int pos = verify_position(name);
     jsin->seek(pos);
@@ -254,7 +331,12 @@ double JsonObject::get_float(const std::string &name)
 
 double JsonObject::get_float(const std::string &name, const double fallback)
 {
-    int pos = positions[name];
+    return get_float( name.c_str(), fallback );
+}
+
+double JsonObject::get_float( const char *name, const double fallback )
+{
+    int pos = get_position( name );
     if (pos <= start) {
         return fallback;
     }
@@ -263,6 +345,11 @@ double JsonObject::get_float(const std::string &name, const double fallback)
 }
 
 std::string JsonObject::get_string(const std::string &name)
+{
+    return get_string( name.c_str() );
+}
+
+std::string JsonObject::get_string( const char *name )
 {
     int pos = verify_position(name);
     jsin->seek(pos);
@@ -271,7 +358,12 @@ std::string JsonObject::get_string(const std::string &name)
 
 std::string JsonObject::get_string(const std::string &name, const std::string &fallback)
 {
-    int pos = positions[name];
+    return get_string( name.c_str(), fallback );
+}
+
+std::string JsonObject::get_string( const char *name, const std::string &fallback )
+{
+    int pos = get_position( name );
     if (pos <= start) {
         return fallback;
     }
@@ -283,7 +375,12 @@ std::string JsonObject::get_string(const std::string &name, const std::string &f
 
 JsonArray JsonObject::get_array(const std::string &name)
 {
-    int pos = positions[name];
+    return get_array( name.c_str() );
+}
+
+JsonArray JsonObject::get_array( const char *name )
+{
+    int pos = get_position( name );
     if (pos <= start) {
         return JsonArray(); // empty array
     }
@@ -313,7 +410,12 @@ std::vector<std::string> JsonObject::get_string_array(const std::string &name)
 
 JsonObject JsonObject::get_object(const std::string &name)
 {
-    int pos = positions[name];
+    return get_object( name.c_str() );
+}
+
+JsonObject JsonObject::get_object( const char *name )
+{
+    int pos = get_position( name );
     if (pos <= start) {
         return JsonObject(); // empty object
     }
@@ -1661,21 +1763,36 @@ void JsonOut::write_null()
 }
 
 void JsonOut::write( const std::string &val )
+{
+    write_string( val.data(), val.size() );
+}
+
+void JsonOut::write( const char *val )
+{
+    write_string( val, strlen( val ) );
+}
+
+void JsonOut::write_string( const char *val, const size_t length )
 {
     if (need_separator) {
         write_separator();
     }
-    unsigned char ch;
     stream->put('"');
-    for( const auto &i : val ) {
-        ch = i;
+    // Characters that don't need escaping (nearly all of them) are passed
+    // to the stream in runs instead of one by one.
+    const char *run_start = val;
+    const char *const val_end = val + length;
+    for( const char *i = val; i != val_end; ++i ) {
+        const unsigned char ch = *i;
+        if( ch >= 0x20 && ch != '"' && ch != '\\' ) {
+            continue;
+        }
+        stream->write( run_start, i - run_start );
+        run_start = i + 1;
         if (ch == '"') {
             stream->write("\\\"", 2);
         } else if (ch == '\\') {
             stream->write("\\\\", 2);
-        } else if (ch == '/') {
-            // don't technically need to escape this
-            stream->put('/');
         } else if (ch == '\b') {
             stream->write("\\b", 2);
         } else if (ch == '\f') {
@@ -1686,7 +1803,7 @@ void JsonOut::write( const std::string &val )
             stream->write("\\r", 2);
         } else if (ch == '\t') {
             stream->write("\\t", 2);
-        } else if (ch < 0x20) {
+        } else {
             // convert to "\uxxxx" unicode escape
             stream->write("\\u00", 4);
             stream->put((ch < 0x10) ? '0' : '1');
@@ -1696,10 +1813,9 @@ void JsonOut::write( const std::string &val )
             } else {
                 stream->put('A' + (remainder - 0x0A));
             }
-        } else {
-            stream->put(ch);
         }
     }
+    stream->write( run_start, val_end - run_start );
     stream->put('"');
     need_separator = true;
 }
@@ -1736,6 +1852,12 @@ void JsonOut::member(const std::string &name)
     write_member_separator();
 }
 
+void JsonOut::member( const char *name )
+{
+    write( name );
+    write_member_separator();
+}
+
 void JsonOut::null_member(const std::string &name)
 {
     member(name);
@@ -425,6 +425,9 @@ class JsonOut
         bool need_separator = false;
         int indent_level = 0;
 
+        // writes a quoted and escaped string
+        void write_string( const char *val, size_t length );
+
     public:
         JsonOut(std::ostream &stream, bool pretty_print = false);
 
@@ -456,7 +459,7 @@ class JsonOut
 
         // strings need escaping and quoting
         void write( const std::string &val );
-        void write( const char *val ) { write( std::string( val ) ); }
+        void write( const char *val );
 
         // char should always be written as an unquoted numeral
         void write(          char val ) { write( static_cast<int>( val ) ); }
@@ -526,13 +529,20 @@ class JsonOut
         }
 
         // convenience methods for writing named object members
+        // the const char * overloads avoid creating a std::string for literal names
         void member(const std::string &name); // TODO: enforce value after
+        void member( const char *name );
         void null_member(const std::string &name);
         template <typename T> void member(const std::string &name, const T &value)
         {
             member(name);
             write(value);
         }
+        template <typename T> void member( const char *name, const T &value )
+        {
+            member( name );
+            write( value );
+        }
 };
 
 
@@ -598,13 +608,19 @@ class JsonOut
 class JsonObject
 {
     private:
-        std::map<std::string, int> positions;
+        // member name and value position, sorted by name for binary search
+        std::vector<std::pair<std::string, int>> positions;
         int start;
         int end;
         bool final_separator;
         JsonIn *jsin;
         int verify_position(const std::string &name,
                             const bool throw_exception = true);
+        int verify_position( const char *name, const bool throw_exception = true );
+        // position of the named member, or 0 if there is no such member
+        int get_position( const char *name, size_t length ) const;
+        int get_position( const std::string &name ) const;
+        int get_position( const char *name ) const;
 
     public:
         JsonObject(JsonIn &jsin);
@@ -620,6 +636,7 @@ class JsonObject
         bool empty();
 
         bool has_member(const std::string &name); // true iff named member exists
+        bool has_member( const char *name );
         std::set<std::string> get_member_names();
         std::string str(); // copy object json as string
         void throw_error(std::string err);
@@ -630,16 +647,25 @@ class JsonObject
         // values by name
         // variants with no fallback throw an error if the name is not found.
         // variants with a fallback return the fallback value in stead.
+        // the const char * overloads look up literal names without building a std::string.
         bool get_bool(const std::string &name);
         bool get_bool(const std::string &name, const bool fallback);
+        bool get_bool( const char *name );
+        bool get_bool( const char *name, const bool fallback );
         int get_int(const std::string &name);
         int get_int(const std::string &name, const int fallback);
+        int get_int( const char *name );
+        int get_int( const char *name, const int fallback );
         long get_long(const std::string &name);
         long get_long(const std::string &name, const long fallback);
         double get_float(const std::string &name);
         double get_float(const std::string &name, const double fallback);
+        double get_float( const char *name );
+        double get_float( const char *name, const double fallback );
         std::string get_string(const std::string &name);
         std::string get_string(const std::string &name, const std::string &fallback);
+        std::string get_string( const char *name );
+        std::string get_string( const char *name, const std::string &fallback );
 
         template<typename E, typename = typename std::enable_if<std::is_enum<E>::value>::type>
         E get_enum_value( const std::string &name, const E fallback )
@@ -660,10 +686,12 @@ class JsonObject
         // containers by name
         // get_array returns empty array if the member is not found
         JsonArray get_array(const std::string &name);
+        JsonArray get_array( const char *name );
         std::vector<int> get_int_array(const std::string &name);
         std::vector<std::string> get_string_array(const std::string &name);
         // get_object returns empty object if not found
         JsonObject get_object(const std::string &name);
+        JsonObject get_object( const char *name );
 
         // get_tags returns empty set if none found
         template <typename T = std::string>
@@ -692,7 +720,7 @@ class JsonObject
         // return false if the member is not found.
         template <typename T> bool read(const std::string &name, T &t)
         {
-            int pos = positions[name];
+            int pos = get_position( name );
             if (pos <= start) {
                 return false;
             }
@@ -902,7 +930,7 @@ template <typename T>
 std::set<T> JsonObject::get_tags( const std::string &name )
 {
     std::set<T> res;
-    int pos = positions[ name ];
+    int pos = get_position( name );
     if ( pos <= start ) {
         return res;
     }
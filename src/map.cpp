@@ -6484,6 +6484,56 @@ void map::shift( const int sx, const int sy )
     }
 }
 
+void map::prefetch_submaps( const int dx, const int dy, const int distance ) const
+{
+    if( dx == 0 && dy == 0 ) {
+        return;
+    }
+    const int zmin = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    std::vector<tripoint> submaps;
+    for( int i = 1; i <= distance; i++ ) {
+        // The row/column that enters the map on the i-th shift, plus one submap on each side
+        // in case the direction of travel bends a bit.
+        const int edgex = dx > 0 ? my_MAPSIZE - 1 + i : -i;
+        const int edgey = dy > 0 ? my_MAPSIZE - 1 + i : -i;
+        for( int n = -1; n <= my_MAPSIZE; n++ ) {
+            for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+                if( dx != 0 ) {
+                    submaps.emplace_back( abs_sub.x + edgex, abs_sub.y + n + dy * i, gridz );
+                }
+                if( dy != 0 ) {
+                    submaps.emplace_back( abs_sub.x + n + dx * i, abs_sub.y + edgey, gridz );
+                }
+            }
+        }
+    }
+    MAPBUFFER.prefetch( submaps );
+}
+
+void map::prefetch_map_area( const tripoint &sm ) const
+{
+    const int zmin = zlevels ? -OVERMAP_DEPTH : sm.z;
+    const int zmax = zlevels ? OVERMAP_HEIGHT : sm.z;
+    std::vector<tripoint> submaps;
+    std::vector<point> overmaps;
+    // Same order as in load, so the first submaps needed are the first ones read.
+    for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+        for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+            for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+                submaps.emplace_back( sm.x + gridx, sm.y + gridy, gridz );
+            }
+            const point om = sm_to_om_copy( sm.x + gridx, sm.y + gridy );
+            if( std::find( overmaps.begin(), overmaps.end(), om ) == overmaps.end() ) {
+                overmaps.push_back( om );
+            }
+        }
+    }
+    // The overmap files are read by their own threads, independent of the map quads.
+    overmap_buffer.prefetch( overmaps );
+    MAPBUFFER.prefetch( submaps );
+}
+
 void map::vertical_shift( const int newz )
 {
     if( !zlevels ) {
@@ -7776,6 +7826,40 @@ void map::draw_fill_background( ter_id type )
     }
 }
 
+void map::draw_quad( const std::vector<ter_id> &ter, const std::vector<furn_id> &furn )
+{
+    // Same as draw_fill_background, whatever changes, the caches are simply dirty.
+    set_transparency_cache_dirty( abs_sub.z );
+    set_outside_cache_dirty( abs_sub.z );
+    set_floor_cache_dirty( abs_sub.z );
+    set_pathfinding_cache_dirty( abs_sub.z );
+
+    constexpr int quad_height = SEEY * 2;
+    for( int gridx = 0; gridx < 2; gridx++ ) {
+        for( int gridy = 0; gridy < 2; gridy++ ) {
+            submap *const sm = get_submap_at_grid( gridx, gridy );
+            sm->is_uniform = false;
+            for( int x = 0; x < SEEX; x++ ) {
+                const size_t column = ( gridx * SEEX + x ) * quad_height + gridy * SEEY;
+                for( int y = 0; y < SEEY; y++ ) {
+                    const ter_id t = ter[column + y];
+                    if( t != t_null ) {
+                        sm->ter[x][y] = t;
+                    }
+                    const furn_id f = furn[column + y];
+                    if( f != f_null ) {
+                        sm->frn[x][y] = f;
+                        // See furn_set
+                        const tripoint p( gridx * SEEX + x, gridy * SEEY + y, abs_sub.z );
+                        support_dirty( p );
+                        support_dirty( tripoint( p.x, p.y, p.z + 1 ) );
+                    }
+                }
+            }
+        }
+    }
+}
+
 void map::draw_fill_background( ter_id( *f )() )
 {
     draw_square_ter( f, 0, 0, SEEX * my_MAPSIZE - 1, SEEY * my_MAPSIZE - 1 );
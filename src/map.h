@@ -301,6 +301,20 @@ class map
      * Note: the map must have been loaded before this can be called.
      */
     void shift( const int sx, const int sy );
+    /**
+     * Let @ref MAPBUFFER read the submaps that would come into the map when
+     * shifting it repeatedly along (dx,dy) from disk in the background.
+     * @param dx, dy Direction of travel, each must be -1, 0 or 1.
+     * @param distance Number of shifts to look ahead.
+     */
+    void prefetch_submaps( int dx, int dy, int distance ) const;
+    /**
+     * Let @ref MAPBUFFER and @ref overmapbuffer read the submaps of the whole map when
+     * placed at sm (what would become @ref abs_sub) and the overmaps they are on from
+     * disk in the background. Loading the map there then only has to wait for the first
+     * of them. Only used for the main map, temporary maps don't load enough to benefit.
+     */
+    void prefetch_map_area( const tripoint &sm ) const;
     /**
      * Moves the map vertically to (not by!) newz.
      * Does not actually shift anything, only forces cache updates.
@@ -689,6 +703,14 @@ void draw_line_furn(furn_id type, int x1, int y1, int x2, int y2);
 void draw_fill_background(ter_id type);
 void draw_fill_background(ter_id (*f)());
 void draw_fill_background(const id_or_id<ter_t> & f);
+/**
+ * Copies terrain and furniture for the first 2x2 submaps straight into the submaps, for
+ * pre-resolved mapgen (see mapgen_function_json). Both arrays have SEEX * 2 * SEEY * 2
+ * entries, index x * SEEY * 2 + y. t_null / f_null keep what is there.
+ * Unlike @ref ter_set, this does not track terrain with a built-in trap or without a
+ * floor, such terrain must be set with @ref ter_set afterwards.
+ */
+void draw_quad( const std::vector<ter_id> &ter, const std::vector<furn_id> &furn );
 
 void draw_square_ter(ter_id type, int x1, int y1, int x2, int y2);
 void draw_square_furn(furn_id type, int x1, int y1, int x2, int y2);
@@ -1065,7 +1087,16 @@ public:
     void process_falling();
 
 // mapgen.cpp functions
+ /**
+  * Generates the quad of submaps at (x, y, z) (absolute submap coordinates, x and y must
+  * be even) and stores it in @ref MAPBUFFER.
+  * Everything random is drawn from a private engine seeded with @ref generation_seed,
+  * so a quad comes out the same no matter when, or in which order with other quads, it
+  * is generated.
+  */
  void generate(const int x, const int y, const int z, const int turn);
+ /** Seed for generating the quad at @p quad (absolute submap coordinates of its corner). */
+ static unsigned int generation_seed( const tripoint &quad );
  void place_spawns(const mongroup_id& group, const int chance,
                    const int x1, const int y1, const int x2, const int y2, const float density);
  void place_gas_pump(const int x, const int y, const int charges);
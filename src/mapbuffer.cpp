@@ -14,14 +14,23 @@
 #include "trap.h"
 #include "vehicle.h"
 #include "submap.h"
+#include "file_prefetch.h"
 
+#include <algorithm>
 #include <sstream>
 
 #define dbg(x) DebugLog((DebugLevel)(x),D_MAP) << __FILE__ << ":" << __LINE__ << ": "
 
 mapbuffer MAPBUFFER;
 
-mapbuffer::mapbuffer()
+// Upper bound for read ahead quads. A quad file is typically a few KB up to a few hundred KB
+// (for cities full of items).
+static constexpr size_t max_prefetched_quads = 256;
+// Loading a game requests all quads of the reality bubble at once, a few parallel reads keep
+// the disk busy while the main thread deserializes them.
+static constexpr size_t prefetch_workers = 4;
+
+mapbuffer::mapbuffer() : prefetcher( new file_prefetcher( prefetch_workers, max_prefetched_quads ) )
 {
 }
 
@@ -36,6 +45,117 @@ void mapbuffer::reset()
         delete elem.second;
     }
     submaps.clear();
+    quad_last_used.clear();
+    clear_lookup_cache();
+    prefetcher->clear();
+}
+
+// A segment is a chunk of 32x32 submap quads.
+// We're breaking them into subdirectories so there aren't too many files per directory.
+static std::string quad_dir_path( const tripoint &om_addr )
+{
+    const tripoint segment_addr = omt_to_seg_copy( om_addr );
+    std::stringstream dirname;
+    dirname << world_generator->active_world->world_path << "/maps/" <<
+            segment_addr.x << "." << segment_addr.y << "." << segment_addr.z;
+    return dirname.str();
+}
+
+static std::string quad_file_path( const tripoint &om_addr )
+{
+    std::stringstream quad_path;
+    quad_path << quad_dir_path( om_addr ) << "/" <<
+              om_addr.x << "." << om_addr.y << "." << om_addr.z << ".map";
+    return quad_path.str();
+}
+
+// Whether the quad is (partially) part of the main map.
+static bool quad_in_reality_bubble( const tripoint &om_addr )
+{
+    const tripoint map_origin = sm_to_omt_copy( g->m.get_abs_sub() );
+    if( !g->m.has_zlevels() && om_addr.z != g->get_levz() ) {
+        return false;
+    }
+    return om_addr.x >= map_origin.x && om_addr.y >= map_origin.y &&
+           om_addr.x <= map_origin.x + ( MAPSIZE / 2 ) &&
+           om_addr.y <= map_origin.y + ( MAPSIZE / 2 );
+}
+
+static size_t submap_bytes( const submap &sm )
+{
+    size_t items = 0;
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            items += sm.itm[x][y].size();
+        }
+    }
+    return sizeof( submap ) + items * sizeof( item ) + sm.vehicles.size() * sizeof( vehicle );
+}
+
+size_t mapbuffer::resident_bytes() const
+{
+    size_t result = 0;
+    for( const auto &elem : submaps ) {
+        if( elem.second != nullptr ) {
+            result += submap_bytes( *elem.second );
+        }
+    }
+    return result;
+}
+
+void mapbuffer::enforce_memory_budget( const size_t budget )
+{
+    if( budget == 0 || world_generator->active_world == nullptr ) {
+        return;
+    }
+    size_t used = resident_bytes();
+    if( used <= budget ) {
+        return;
+    }
+
+    std::vector<std::pair<unsigned long, tripoint>> candidates;
+    for( const auto &elem : quad_last_used ) {
+        if( !quad_in_reality_bubble( elem.first ) ) {
+            candidates.emplace_back( elem.second, elem.first );
+        }
+    }
+    std::sort( candidates.begin(), candidates.end() );
+
+    for( const auto &candidate : candidates ) {
+        if( used <= budget ) {
+            break;
+        }
+        const tripoint &om_addr = candidate.second;
+        std::list<tripoint> submaps_to_delete;
+        save_quad( quad_dir_path( om_addr ), quad_file_path( om_addr ), om_addr, submaps_to_delete,
+                   true );
+        for( auto &elem : submaps_to_delete ) {
+            const auto iter = submaps.find( elem );
+            if( iter != submaps.end() && iter->second != nullptr ) {
+                used -= std::min( used, submap_bytes( *iter->second ) );
+            }
+            remove_submap( elem );
+            evicted++;
+        }
+    }
+}
+
+void mapbuffer::prefetch( const std::vector<tripoint> &submap_addrs )
+{
+    if( world_generator->active_world == nullptr ) {
+        return;
+    }
+    for( const tripoint &p : submap_addrs ) {
+        if( submaps.count( p ) != 0 ) {
+            continue;
+        }
+        prefetcher->request( quad_file_path( sm_to_omt_copy( p ) ) );
+    }
+}
+
+size_t mapbuffer::prefetched_count() const
+{
+    return prefetcher->staged_count();
 }
 
 bool mapbuffer::add_submap(const tripoint &p, submap *sm)
@@ -45,6 +165,7 @@ bool mapbuffer::add_submap(const tripoint &p, submap *sm)
     }
 
     submaps[p] = sm;
+    touch( p );
 
     return true;
 }
@@ -75,6 +196,23 @@ void mapbuffer::remove_submap( tripoint addr )
     }
     delete m_target->second;
     submaps.erase( m_target );
+    quad_last_used.erase( sm_to_omt_copy( addr ) );
+    // Entries of the other submaps of the quad point to the usage stamp that was just erased.
+    clear_lookup_cache();
+}
+
+unsigned long &mapbuffer::touch( const tripoint &addr )
+{
+    unsigned long &stamp = quad_last_used[sm_to_omt_copy( addr )];
+    stamp = ++access_counter;
+    return stamp;
+}
+
+void mapbuffer::clear_lookup_cache()
+{
+    for( auto &entry : lookup_cache ) {
+        entry = lookup_cache_entry();
+    }
 }
 
 submap *mapbuffer::lookup_submap(int x, int y, int z)
@@ -84,10 +222,15 @@ submap *mapbuffer::lookup_submap(int x, int y, int z)
 
 submap *mapbuffer::lookup_submap( const tripoint &p )
 {
-    dbg(D_INFO) << "mapbuffer::lookup_submap( x[" << p.x << "], y[" << p.y << "], z[" << p.z << "])";
+    lookup_cache_entry &cached = lookup_cache[( p.x & 3 ) | ( ( p.y & 3 ) << 2 )];
+    if( cached.sm != nullptr && cached.pos == p ) {
+        *cached.last_used = ++access_counter;
+        return cached.sm;
+    }
 
     auto iter = submaps.find( p );
     if( iter == submaps.end() ) {
+        dbg(D_INFO) << "mapbuffer::lookup_submap( x[" << p.x << "], y[" << p.y << "], z[" << p.z << "])";
         try {
             return unserialize_submaps( p );
         } catch (const std::exception &err) {
@@ -96,6 +239,9 @@ submap *mapbuffer::lookup_submap( const tripoint &p )
         return NULL;
     }
 
+    cached.pos = p;
+    cached.sm = iter->second;
+    cached.last_used = &touch( p );
     return iter->second;
 }
 
@@ -108,51 +254,30 @@ void mapbuffer::save( bool delete_after_save )
     int num_saved_submaps = 0;
     int num_total_submaps = submaps.size();
 
-    const tripoint map_origin = sm_to_omt_copy( g->m.get_abs_sub() );
-    const bool map_has_zlevels = g != nullptr && g->m.has_zlevels();
+    // Whatever the coordinates of the current submap are,
+    // we're saving a 2x2 quad of submaps at a time.
+    // Submaps are generated in quads, so we know if we have one member of a quad,
+    // we have the rest of it, if that assumption is broken we have REAL problems.
+    // The set (in global overmap coordinates) also makes the order of saving independent
+    // of the hash table layout.
+    std::set<tripoint> quads_to_save;
+    for( auto &elem : submaps ) {
+        quads_to_save.insert( sm_to_omt_copy( elem.first ) );
+    }
 
-    // A set of already-saved submaps, in global overmap coordinates.
-    std::set<tripoint> saved_submaps;
     std::list<tripoint> submaps_to_delete;
     int next_report = 0;
-    for( auto &elem : submaps ) {
+    for( const tripoint &om_addr : quads_to_save ) {
         if( num_total_submaps > 100 && num_saved_submaps >= next_report ) {
             popup_nowait(_("Please wait as the map saves [%d/%d]"),
                          num_saved_submaps, num_total_submaps);
             next_report += std::max( 100, num_total_submaps / 20 );
         }
 
-        // Whatever the coordinates of the current submap are,
-        // we're saving a 2x2 quad of submaps at a time.
-        // Submaps are generated in quads, so we know if we have one member of a quad,
-        // we have the rest of it, if that assumption is broken we have REAL problems.
-        const tripoint om_addr = sm_to_omt_copy( elem.first );
-        if( saved_submaps.count( om_addr ) != 0 ) {
-            // Already handled this one.
-            continue;
-        }
-        saved_submaps.insert( om_addr );
-
-        // A segment is a chunk of 32x32 submap quads.
-        // We're breaking them into subdirectories so there aren't too many files per directory.
-        // Might want to make a set for this one too so it's only checked once per save().
-        std::stringstream dirname;
-        tripoint segment_addr = omt_to_seg_copy( om_addr );
-        dirname << map_directory.str() << "/" << segment_addr.x << "." <<
-                     segment_addr.y << "." << segment_addr.z;
-
-        std::stringstream quad_path;
-        quad_path << dirname.str() << "/" << om_addr.x << "." <<
-                  om_addr.y << "." << om_addr.z << ".map";
-
         // delete_on_save deletes everything, otherwise delete submaps
         // outside the current map.
-        const bool zlev_del = !map_has_zlevels && om_addr.z != g->get_levz();
-        save_quad( dirname.str(), quad_path.str(), om_addr, submaps_to_delete,
-                   delete_after_save || zlev_del ||
-                   om_addr.x < map_origin.x || om_addr.y < map_origin.y ||
-                   om_addr.x > map_origin.x + (MAPSIZE / 2) ||
-                   om_addr.y > map_origin.y + (MAPSIZE / 2) );
+        save_quad( quad_dir_path( om_addr ), quad_file_path( om_addr ), om_addr, submaps_to_delete,
+                   delete_after_save || !quad_in_reality_bubble( om_addr ) );
         num_saved_submaps += 4;
     }
     for( auto &elem : submaps_to_delete ) {
@@ -177,7 +302,8 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         submap_addr.x += offsets_offset.x;
         submap_addr.y += offsets_offset.y;
         submap_addrs.push_back( submap_addr );
-        submap *sm = submaps[submap_addr];
+        const auto iter = submaps.find( submap_addr );
+        submap *sm = iter != submaps.end() ? iter->second : nullptr;
         if( sm != nullptr && !sm->is_uniform ) {
             all_uniform = false;
         }
@@ -187,7 +313,8 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         // Nothing to save - this quad will be regenerated faster than it would be re-read
         if( delete_after_save ) {
             for( auto &submap_addr : submap_addrs ) {
-                if( submaps.count( submap_addr ) > 0 && submaps[submap_addr] != nullptr ) {
+                const auto iter = submaps.find( submap_addr );
+                if( iter != submaps.end() && iter->second != nullptr ) {
                     submaps_to_delete.push_back( submap_addr );
                 }
             }
@@ -196,20 +323,20 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         return;
     }
 
+    // Anything read ahead is outdated now.
+    prefetcher->discard( filename );
+
     // Don't create the directory if it would be empty
     assure_dir_exist( dirname.c_str() );
     ofstream_wrapper_exclusive fout( filename );
     JsonOut jsout( fout );
     jsout.start_array();
     for( auto &submap_addr : submap_addrs ) {
-        if( submaps.count( submap_addr ) == 0 ) {
-            continue;
-        }
-
-        submap *sm = submaps[submap_addr];
-        if( sm == nullptr ) {
+        const auto iter = submaps.find( submap_addr );
+        if( iter == submaps.end() || iter->second == nullptr ) {
             continue;
         }
+        submap *sm = iter->second;
 
         jsout.start_object();
 
@@ -396,19 +523,15 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
 {
     // Map the tripoint to the submap quad that stores it.
     const tripoint om_addr = sm_to_omt_copy( p );
-    const tripoint segment_addr = omt_to_seg_copy( om_addr );
-    std::stringstream quad_path;
-    quad_path << world_generator->active_world->world_path << "/maps/" <<
-              segment_addr.x << "." << segment_addr.y << "." << segment_addr.z << "/" <<
-              om_addr.x << "." << om_addr.y << "." << om_addr.z << ".map";
+    const std::string quad_path = quad_file_path( om_addr );
 
     using namespace std::placeholders;
-    if( !read_from_file_optional( quad_path.str(), std::bind( &mapbuffer::deserialize, this, _1 ) ) ) {
+    if( !prefetcher->read_optional( quad_path, std::bind( &mapbuffer::deserialize, this, _1 ) ) ) {
         // If it doesn't exist, trigger generating it.
         return NULL;
     }
     if( submaps.count( p ) == 0 ) {
-        debugmsg("file %s did not contain the expected submap %d,%d,%d", quad_path.str().c_str(), p.x, p.y,
+        debugmsg("file %s did not contain the expected submap %d,%d,%d", quad_path.c_str(), p.x, p.y,
                  p.z);
         return NULL;
     }
@@ -5,10 +5,13 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "enums.h"
 struct point;
 struct tripoint;
 struct submap;
+class file_prefetcher;
 
 /**
  * Store, buffer, save and load the entire world map.
@@ -57,8 +60,38 @@ class mapbuffer
         submap *lookup_submap( int x, int y, int z );
         submap *lookup_submap( const tripoint &p );
 
+        /**
+         * Start reading the stored quads of the given submaps from disk in the
+         * background, so a later @ref lookup_submap of them doesn't have to wait for it.
+         * Submaps that are already loaded are ignored.
+         * @param submap_addrs Absolute world positions in submap coordinates.
+         */
+        void prefetch( const std::vector<tripoint> &submap_addrs );
+        /** Number of quads read ahead by @ref prefetch, but not looked up yet. */
+        size_t prefetched_count() const;
+
+        /**
+         * Save and unload the least recently used quads outside of the reality bubble
+         * until the buffered submaps fit into the memory budget.
+         * Must not be called while any map other than the main one (e.g. a tinymap
+         * used by mapgen) holds pointers to buffered submaps.
+         * @param budget Memory budget in bytes, 0 means unlimited.
+         */
+        void enforce_memory_budget( size_t budget );
+
+        /** Number of submaps currently in memory. */
+        size_t resident_count() const {
+            return submaps.size();
+        }
+        /** Estimated memory used by the submaps currently in memory, in bytes. */
+        size_t resident_bytes() const;
+        /** Number of submaps unloaded by @ref enforce_memory_budget so far. */
+        size_t evicted_count() const {
+            return evicted;
+        }
+
     private:
-        typedef std::map<tripoint, submap *> submap_map_t;
+        typedef std::unordered_map<tripoint, submap *> submap_map_t;
 
     public:
         inline submap_map_t::iterator begin() {
@@ -72,12 +105,36 @@ class mapbuffer
         // There's a very good reason this is private,
         // if not handled carefully, this can erase in-use submaps and crash the game.
         void remove_submap( tripoint addr );
+        /**
+         * Mark the quad of the submap as most recently used.
+         * @return The usage stamp of the quad, see @ref quad_last_used.
+         */
+        unsigned long &touch( const tripoint &addr );
+        void clear_lookup_cache();
         submap *unserialize_submaps( const tripoint &p );
         void deserialize( JsonIn &jsin );
         void save_quad( const std::string &dirname, const std::string &filename,
                         const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
                         bool delete_after_save );
         submap_map_t submaps;
+        std::unique_ptr<file_prefetcher> prefetcher;
+        /** Last access of each quad (in overmap terrain coordinates), see @ref touch. */
+        std::unordered_map<tripoint, unsigned long> quad_last_used;
+        unsigned long access_counter = 0;
+
+        /**
+         * Recent hits of @ref lookup_submap. Entries are indexed by the lowest bits of
+         * the submap position, so the submaps around the one that has just been looked up
+         * (as during a map shift) don't evict each other.
+         */
+        struct lookup_cache_entry {
+            tripoint pos;
+            submap *sm = nullptr;
+            unsigned long *last_used = nullptr;
+        };
+        static constexpr int lookup_cache_size = 16;
+        lookup_cache_entry lookup_cache[lookup_cache_size];
+        size_t evicted = 0;
 };
 
 extern mapbuffer MAPBUFFER;
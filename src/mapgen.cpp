@@ -109,6 +109,16 @@ void madd_trap( map *m, int x, int y, trap_id t );
 void mremove_trap( map *m, int x, int y );
 void mtrap_set( map *m, int x, int y, trap_id t );
 
+unsigned int map::generation_seed( const tripoint &quad )
+{
+    // Same mixing as boost::hash_combine, each level of a quad is generated on its own.
+    unsigned int seed = g != nullptr ? g->get_seed() : 0;
+    seed ^= std::hash<int>()( quad.x ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+    seed ^= std::hash<int>()( quad.y ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+    seed ^= std::hash<int>()( quad.z ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 );
+    return seed;
+}
+
 // (x,y,z) are absolute coordinates of a submap
 // x%2 and y%2 must be 0!
 void map::generate(const int x, const int y, const int z, const int turn)
@@ -116,6 +126,7 @@ void map::generate(const int x, const int y, const int z, const int turn)
     dbg(D_INFO) << "map::generate( g[" << g << "], x[" << x << "], "
                 << "y[" << y << "], z[" << z <<"], turn[" << turn << "] )";
 
+    rng_seed_scope seed( generation_seed( tripoint( x, y, z ) ) );
     set_abs_sub( x, y, z );
 
     // First we have to create new submaps and initialize them to 0 all over
@@ -1416,6 +1427,7 @@ bool mapgen_function_json::setup() {
             }
             qualifies = true;
             do_format = true;
+            compile_format();
        }
 
        // No fill_ter? No format? GTFO.
@@ -1567,24 +1579,29 @@ bool jmapgen_setmap::apply( map *m ) {
     return true;
 }
 
-void mapgen_function_json::formatted_set_incredibly_simple( map * const m ) const
+void mapgen_function_json::compile_format()
 {
-    for( size_t y = 0; y < mapgensize; y++ ) {
-        for( size_t x = 0; x < mapgensize; x++ ) {
-            const size_t index = calc_index( x, y );
-            const ter_furn_id &tdata = format[index];
-            if( tdata.furn != f_null ) {
-                if( tdata.ter != t_null ) {
-                    m->set( x, y, tdata.ter, tdata.furn );
-                } else if( fill_ter != t_null ) {
-                    m->set( x, y, fill_ter, tdata.furn );
-                } else {
-                    m->furn_set( x, y, tdata.furn );
-                }
-            } else if( tdata.ter != t_null ) {
-                m->ter_set( x, y, tdata.ter );
-            } else if( fill_ter != t_null ) {
-                m->ter_set( x, y, fill_ter );
+    // map::draw_quad always writes a whole quad, json mapgen is exactly that size.
+    static_assert( SEEX == SEEY, "json mapgen assumes square submaps" );
+    quad_ter.assign( mapgensize * mapgensize, t_null );
+    quad_furn.assign( mapgensize * mapgensize, f_null );
+    quad_ter_special.clear();
+    for( size_t x = 0; x < mapgensize; x++ ) {
+        for( size_t y = 0; y < mapgensize; y++ ) {
+            const ter_furn_id &tdata = format[calc_index( x, y )];
+            const size_t index = x * mapgensize + y;
+            quad_furn[index] = tdata.furn;
+            const ter_id ter = tdata.ter != t_null ? tdata.ter : fill_ter;
+            if( ter == t_null ) {
+                continue;
+            }
+            const ter_t &info = ter.obj();
+            if( ( info.trap != tr_null && info.trap != tr_ledge ) || info.has_flag( TFLAG_NO_FLOOR ) ) {
+                // ter_set keeps track of those, the tile is filled like the background first.
+                quad_ter[index] = fill_ter;
+                quad_ter_special.emplace_back( point( x, y ), ter );
+            } else {
+                quad_ter[index] = ter;
             }
         }
     }
@@ -1594,11 +1611,14 @@ void mapgen_function_json::formatted_set_incredibly_simple( map * const m ) cons
  * Apply mapgen as per a derived-from-json recipe; in theory fast, but not very versatile
  */
 void mapgen_function_json::generate( map *m, const oter_id &terrain_type, const mapgendata &md, int t, float d ) {
-    if ( fill_ter != t_null ) {
-        m->draw_fill_background( fill_ter );
-    }
     if ( do_format ) {
-        formatted_set_incredibly_simple( m );
+        // The compiled format already contains fill_ter.
+        m->draw_quad( quad_ter, quad_furn );
+        for( const auto &special : quad_ter_special ) {
+            m->ter_set( special.first.x, special.first.y, special.second );
+        }
+    } else if ( fill_ter != t_null ) {
+        m->draw_fill_background( fill_ter );
     }
     for( auto &elem : setmap_points ) {
         elem.apply( m );
@@ -8814,7 +8834,7 @@ FFFFFFFFFFFFFFFFFFFFFFFF\n\
         for(int a = 0; a < 21; a++ ) {
             vset.push_back(a);
         }
-        std::random_shuffle(vset.begin(), vset.end());
+        random_shuffle_rng(vset.begin(), vset.end());
         for(int a = 0; a < vnum; a++) {
             if (vset[a] < 12) {
                 if (one_in(2)) {
@@ -9017,7 +9037,7 @@ FFFFFFFFFFFFFFFFFFFFFFFF\n\
         for(int a = 0; a < 17; a++) {
             vset.push_back(a);
         }
-        std::random_shuffle(vset.begin(), vset.end());
+        random_shuffle_rng(vset.begin(), vset.end());
         for(int a = 0; a < vnum; a++) {
             if (vset[a] < 3) {
                 if (one_in(2)) {
@@ -219,7 +219,16 @@ private:
     jmapgen_objects objects;
     jmapgen_int rotation;
 
-    void formatted_set_incredibly_simple( map *m ) const;
+    /**
+     * @ref format (with @ref fill_ter filled in) resolved at setup for @ref map::draw_quad,
+     * index x * mapgensize + y.
+     */
+    std::vector<ter_id> quad_ter;
+    std::vector<furn_id> quad_furn;
+    /** Terrain that has to be set with map::ter_set after map::draw_quad. */
+    std::vector<std::pair<point, ter_id>> quad_ter_special;
+
+    void compile_format();
 };
 
 /////////////////////////////////////////////////////////////////////////////////
@@ -58,6 +58,89 @@ void mongroup::clear() {
     monsters.clear();
 }
 
+tripoint mongroup_map::cell_of( const tripoint &p )
+{
+    // Rounding down, groups may be outside of their overmap (negative coordinates).
+    const auto cell = []( const int v ) {
+        return ( v < 0 ? v - cell_size + 1 : v ) / cell_size;
+    };
+    return tripoint( cell( p.x ), cell( p.y ), p.z );
+}
+
+void mongroup_map::insert( const mongroup &group )
+{
+    cells[cell_of( group.pos )].push_back( groups.size() );
+    groups.push_back( group );
+}
+
+std::vector<mongroup *> mongroup_map::at( const tripoint &p )
+{
+    std::vector<mongroup *> result;
+    const auto iter = cells.find( cell_of( p ) );
+    if( iter == cells.end() ) {
+        return result;
+    }
+    for( const size_t index : iter->second ) {
+        if( groups[index].pos == p ) {
+            result.push_back( &groups[index] );
+        }
+    }
+    return result;
+}
+
+void mongroup_map::move( const size_t index, const tripoint &p )
+{
+    mongroup &group = groups[index];
+    const tripoint old_cell = cell_of( group.pos );
+    const tripoint new_cell = cell_of( p );
+    group.pos = p;
+    if( old_cell == new_cell ) {
+        return;
+    }
+    auto &old_indices = cells[old_cell];
+    old_indices.erase( std::lower_bound( old_indices.begin(), old_indices.end(), index ) );
+    if( old_indices.empty() ) {
+        cells.erase( old_cell );
+    }
+    auto &new_indices = cells[new_cell];
+    new_indices.insert( std::lower_bound( new_indices.begin(), new_indices.end(), index ), index );
+}
+
+void mongroup_map::erase( const std::vector<size_t> &indices )
+{
+    if( indices.empty() ) {
+        return;
+    }
+    size_t next = 0;
+    size_t kept = 0;
+    for( size_t i = 0; i < groups.size(); ++i ) {
+        if( next < indices.size() && indices[next] == i ) {
+            ++next;
+            continue;
+        }
+        if( kept != i ) {
+            groups[kept] = std::move( groups[i] );
+        }
+        ++kept;
+    }
+    groups.erase( groups.begin() + kept, groups.end() );
+    rebuild_cells();
+}
+
+void mongroup_map::clear()
+{
+    groups.clear();
+    cells.clear();
+}
+
+void mongroup_map::rebuild_cells()
+{
+    cells.clear();
+    for( size_t i = 0; i < groups.size(); ++i ) {
+        cells[cell_of( groups[i].pos )].push_back( i );
+    }
+}
+
 const MonsterGroup &MonsterGroupManager::GetUpgradedMonsterGroup( const mongroup_id& group )
 {
     const MonsterGroup *groupptr = &group.obj();
@@ -5,6 +5,8 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <algorithm>
 #include "enums.h"
 #include "json.h"
 #include "string_id.h"
@@ -98,8 +100,14 @@ struct mongroup : public JsonSerializer, public JsonDeserializer {
      *  and return to them whenever possible.
      *  And "roam", who roam around the map randomly, not taking care to return
      *  anywhere.
+     *  It's "none" until @ref overmap::move_hordes picks one.
      */
-    std::string horde_behaviour;
+    enum class behaviour : char {
+        none,
+        city,
+        roam
+    };
+    behaviour horde_behaviour = behaviour::none;
     bool diffuse;   // group size ind. of dist. from center and radius invariant
     mongroup( const mongroup_id &ptype, int pposx, int pposy, int pposz,
               unsigned int prad, unsigned int ppop )
@@ -154,6 +162,92 @@ struct mongroup : public JsonSerializer, public JsonDeserializer {
     void serialize( JsonOut &jsout ) const override;
 };
 
+/**
+ * The monster groups of an overmap. They are stored in one vector, and a coarse grid
+ * (cells of @ref cell_size x @ref cell_size submaps on each z-level) lists the groups
+ * in each cell, so @ref at only looks at the groups near the position.
+ * Adding or removing groups invalidates pointers to the groups.
+ */
+class mongroup_map
+{
+    public:
+        static constexpr int cell_size = 8;
+
+        typedef std::vector<mongroup>::const_iterator const_iterator;
+
+        void insert( const mongroup &group );
+        /**
+         * All groups at exactly @p p, in the order they were added.
+         * Their position must not be changed through the pointers, use @ref move.
+         */
+        std::vector<mongroup *> at( const tripoint &p );
+        /** Change the position of the group, this must be used instead of changing it directly. */
+        void move( size_t index, const tripoint &p );
+        /**
+         * Call @p f with the group at @p index to change it, the group is moved in the cell
+         * grid if its position was changed.
+         */
+        template<typename Function>
+        void update( const size_t index, Function f ) {
+            const tripoint old_pos = groups[index].pos;
+            f( groups[index] );
+            const tripoint new_pos = groups[index].pos;
+            if( new_pos != old_pos ) {
+                groups[index].pos = old_pos;
+                move( index, new_pos );
+            }
+        }
+        /** Like @ref update, for all the groups. */
+        template<typename Function>
+        void update_all( Function f ) {
+            bool moved = false;
+            for( mongroup &group : groups ) {
+                const tripoint old_pos = group.pos;
+                f( group );
+                moved = moved || group.pos != old_pos;
+            }
+            if( moved ) {
+                rebuild_cells();
+            }
+        }
+        /**
+         * Remove the groups for which @p pred returns true. The predicate must not change
+         * this map (e.g. by loading overmaps that add groups to it).
+         */
+        template<typename Predicate>
+        void remove_if( Predicate pred ) {
+            groups.erase( std::remove_if( groups.begin(), groups.end(), pred ), groups.end() );
+            rebuild_cells();
+        }
+        /** Remove the groups at the given indices, which must be sorted. */
+        void erase( const std::vector<size_t> &indices );
+        void clear();
+
+        const mongroup &operator[]( size_t index ) const {
+            return groups[index];
+        }
+        size_t size() const {
+            return groups.size();
+        }
+        bool empty() const {
+            return groups.empty();
+        }
+        const_iterator begin() const {
+            return groups.begin();
+        }
+        const_iterator end() const {
+            return groups.end();
+        }
+
+    private:
+        static tripoint cell_of( const tripoint &p );
+        void rebuild_cells();
+
+        std::vector<mongroup> groups;
+        /** Indices into @ref groups, sorted. */
+        std::unordered_map<tripoint, std::vector<size_t>> cells;
+};
+
 class MonsterGroupManager
 {
     public:
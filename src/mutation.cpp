@@ -19,6 +19,28 @@ bool Character::has_trait(const std::string &b) const
     return my_mutations.count( b ) > 0;
 }
 
+bool Character::has_trait( const trait_id &b ) const
+{
+    const int cid = b.id().to_i();
+    if( cid < 0 ) {
+        return false;
+    }
+    if( trait_lookup_generation != mutation_branch::generation() ||
+        trait_lookup_size != my_mutations.size() ||
+        static_cast<size_t>( cid ) >= trait_lookup.size() ) {
+        trait_lookup.assign( mutation_branch::count(), false );
+        for( const auto &mut : my_mutations ) {
+            const int mut_cid = trait_id( mut.first ).id().to_i();
+            if( mut_cid >= 0 ) {
+                trait_lookup[mut_cid] = true;
+            }
+        }
+        trait_lookup_size = my_mutations.size();
+        trait_lookup_generation = mutation_branch::generation();
+    }
+    return trait_lookup[cid];
+}
+
 bool Character::has_trait_flag( const std::string &b ) const
 {
     // UGLY, SLOW, should be cached as my_mutation_flags or something
@@ -54,6 +76,7 @@ void Character::toggle_trait(const std::string &flag)
         my_mutations.erase( miter );
         mutation_loss_effect(flag);
     }
+    invalidate_trait_lookup();
     recalc_sight_limits();
     reset_encumbrance();
 }
@@ -66,6 +89,7 @@ void Character::set_mutation(const std::string &flag)
     } else {
         debugmsg("Trying to set %s mutation, but the character already has it.", flag.c_str());
     }
+    invalidate_trait_lookup();
     recalc_sight_limits();
     reset_encumbrance();
 }
@@ -78,6 +102,7 @@ void Character::unset_mutation(const std::string &flag)
     } else {
         my_mutations.erase( iter );
     }
+    invalidate_trait_lookup();
     recalc_sight_limits();
     reset_encumbrance();
 }
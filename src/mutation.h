@@ -18,6 +18,7 @@ class martialart;
 using matype_id = string_id<martialart>;
 struct dream;
 struct mutation_branch;
+using trait_id = string_id<mutation_branch>;
 class item;
 
 extern std::vector<dream> dreams;
@@ -121,6 +122,12 @@ struct mutation_branch {
     initial_ma_styles; // Martial art styles that can be chosen upon character generation
     std::string name;
     std::string description;
+    /**
+     * The id of this mutation, its cached int id is the dense index of the mutation.
+     * All mutations are numbered in the order they were loaded, @ref count is one more
+     * than the largest int id.
+     */
+    trait_id id;
     /**
      * Returns the color to display the mutation name with.
      */
@@ -151,6 +158,13 @@ struct mutation_branch {
      * also get by calling @ref get.
      */
     static const MutationMap &get_all();
+    /** Number of known mutations, the int ids are below it. */
+    static size_t count();
+    /**
+     * Changes whenever the mutation data is reset, int ids taken from earlier data
+     * must not be used anymore.
+     */
+    static int generation();
     // For init.cpp: reset (clear) the mutation data
     static void reset_all();
     // For init.cpp: load mutation data from json
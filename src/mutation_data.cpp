@@ -4,6 +4,7 @@
 #include "enums.h" // tripoint
 #include "bodypart.h"
 #include "debug.h"
+#include "int_id.h"
 #include "translations.h"
 
 #include <vector>
@@ -13,6 +14,43 @@ std::vector<dream> dreams;
 std::map<std::string, std::vector<std::string> > mutations_category;
 std::map<std::string, mutation_category_trait> mutation_category_traits;
 std::unordered_map<std::string, mutation_branch> mutation_data;
+/** Entries of @ref mutation_data by their int id. */
+static std::vector<const mutation_branch *> mutation_list;
+static int mutation_generation = 0;
+
+template<>
+int_id<mutation_branch> string_id<mutation_branch>::id() const
+{
+    const int cid = get_cid().to_i();
+    if( cid >= 0 && static_cast<size_t>( cid ) < mutation_list.size() &&
+        mutation_list[cid]->id == *this ) {
+        return int_id<mutation_branch>( cid );
+    }
+    const auto iter = mutation_data.find( str() );
+    if( iter == mutation_data.end() ) {
+        // Unknown traits are quite common in has_trait checks (e.g. of mods that are not
+        // loaded), so no debug message here.
+        return int_id<mutation_branch>( -1 );
+    }
+    set_cid( iter->second.id.get_cid() );
+    return iter->second.id.get_cid();
+}
+
+template<>
+bool string_id<mutation_branch>::is_valid() const
+{
+    return id().to_i() >= 0;
+}
+
+template<>
+const mutation_branch &string_id<mutation_branch>::obj() const
+{
+    const int cid = id().to_i();
+    if( cid < 0 ) {
+        return mutation_branch::get( str() ); // shows the debug message
+    }
+    return *mutation_list[cid];
+}
 
 static void extract_mod(JsonObject &j, std::unordered_map<std::pair<bool, std::string>, int> &data,
                         std::string mod_type, bool active, std::string type_key)
@@ -126,6 +164,11 @@ void mutation_branch::load( JsonObject &jsobj )
 {
     const std::string id = jsobj.get_string( "id" );
     mutation_branch &new_mut = mutation_data[id];
+    if( new_mut.id.is_empty() ) {
+        // The map nodes stay where they are, so the pointer remains valid until reset_all.
+        new_mut.id = trait_id( id, mutation_list.size() );
+        mutation_list.push_back( &new_mut );
+    }
 
     JsonArray jsarr;
     new_mut.name = _(jsobj.get_string("name").c_str());
@@ -325,10 +368,22 @@ const mutation_branch::MutationMap &mutation_branch::get_all()
     return mutation_data;
 }
 
+size_t mutation_branch::count()
+{
+    return mutation_list.size();
+}
+
+int mutation_branch::generation()
+{
+    return mutation_generation;
+}
+
 void mutation_branch::reset_all()
 {
     mutations_category.clear();
+    mutation_list.clear();
     mutation_data.clear();
+    mutation_generation++;
 }
 
 void load_dream(JsonObject &jsobj)
@@ -2394,6 +2394,7 @@ void Character::empty_traits()
     }
     my_traits.clear();
     my_mutations.clear();
+    invalidate_trait_lookup();
 }
 
 void Character::empty_skills()
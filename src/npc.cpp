@@ -1844,25 +1844,71 @@ void npc::shift(int sx, int sy)
     const point pos_om_old = sm_to_om_copy( mapx, mapy );
     mapx += sx;
     mapy += sy;
+    update_overmap( pos_om_old );
+
+    maybe_shift( wanted_item_pos, -shiftx, -shifty );
+    maybe_shift( last_player_seen_pos, -shiftx, -shifty );
+    maybe_shift( pulp_location, -shiftx, -shifty );
+    path.clear();
+}
+
+void npc::update_overmap( const point &pos_om_old )
+{
     const point pos_om_new = sm_to_om_copy( mapx, mapy );
     if( pos_om_old != pos_om_new ) {
-        overmap &om_old = overmap_buffer.get( pos_om_old.x, pos_om_old.y );
-        overmap &om_new = overmap_buffer.get( pos_om_new.x, pos_om_new.y );
-        auto a = std::find(om_old.npcs.begin(), om_old.npcs.end(), this);
-        if (a != om_old.npcs.end()) {
-            om_old.npcs.erase( a );
-            om_new.npcs.push_back( this );
+        // The npc is listed on the old overmap, and the callers only move it onto overmaps
+        // that exist, so neither has to be generated here.
+        overmap *om_old = overmap_buffer.get_existing( pos_om_old.x, pos_om_old.y );
+        overmap *om_new = overmap_buffer.get_existing( pos_om_new.x, pos_om_new.y );
+        if( om_old == nullptr || om_new == nullptr ) {
+            debugmsg( "npc %s moved to or from an overmap that does not exist", name.c_str() );
+            return;
+        }
+        auto a = std::find(om_old->npcs.begin(), om_old->npcs.end(), this);
+        if (a != om_old->npcs.end()) {
+            om_old->npcs.erase( a );
+            om_new->npcs.push_back( this );
         } else {
             // Don't move the npc pointer around to avoid having two overmaps
             // with the same npc pointer
             debugmsg( "could not find npc %s on its old overmap", name.c_str() );
         }
     }
+}
 
-    maybe_shift( wanted_item_pos, -shiftx, -shifty );
-    maybe_shift( last_player_seen_pos, -shiftx, -shifty );
-    maybe_shift( pulp_location, -shiftx, -shifty );
+bool npc::travel_abstract( const int distance )
+{
+    if( goal == no_goal_point ) {
+        return false;
+    }
+    const tripoint current = global_sm_location();
+    const point target = omt_to_sm_copy( goal.x, goal.y );
+    const int dx = std::max( -distance, std::min( distance, target.x - current.x ) );
+    const int dy = std::max( -distance, std::min( distance, target.y - current.y ) );
+    if( dx == 0 && dy == 0 ) {
+        return false;
+    }
+    // The position on the submap stays the same, the npc is placed properly when it's loaded.
+    const point pos_om_old = sm_to_om_copy( mapx, mapy );
+    int new_x = mapx + dx;
+    int new_y = mapy + dy;
+    const point pos_om_new = sm_to_om_copy( new_x, new_y );
+    if( pos_om_new != pos_om_old &&
+        overmap_buffer.get_existing( pos_om_new.x, pos_om_new.y ) == nullptr ) {
+        // Traveling must not generate overmaps, the npc waits at the edge of its overmap
+        // until the player gets there.
+        const point base = om_to_sm_copy( pos_om_old );
+        new_x = std::max( base.x, std::min( base.x + OMAPX * 2 - 1, new_x ) );
+        new_y = std::max( base.y, std::min( base.y + OMAPY * 2 - 1, new_y ) );
+        if( new_x == mapx && new_y == mapy ) {
+            return false;
+        }
+    }
+    mapx = new_x;
+    mapy = new_y;
+    update_overmap( pos_om_old );
     path.clear();
+    return true;
 }
 
 bool npc::is_dead() const
@@ -575,6 +575,14 @@ public:
      * a spiral search for an empty square around it is performed.
      */
     void place_on_map();
+    /**
+     * Move the npc up to @p distance submaps (on each axis) towards its @ref goal,
+     * without simulating the way there. Only for npcs outside of the reality bubble,
+     * see @ref overmapbuffer::process_abstract. It stops at the edge of overmaps that
+     * have not been generated yet.
+     * @return Whether the npc has moved.
+     */
+    bool travel_abstract( int distance );
     /**
      * See @ref npc_chatbin::add_new_mission
      */
@@ -829,6 +837,8 @@ private:
      * (mapx,mapy) defines the overmap the npc is stored on.
      */
     int mapx, mapy;
+    /** Move the npc into the npc list of the overmap it's now on, if it has changed. */
+    void update_overmap( const point &pos_om_old );
     // Type of complaint->last time we complainted about this type
     std::map<std::string, int> complaints;
 
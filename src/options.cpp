@@ -44,6 +44,8 @@ std::map<std::string, int> mOptionsSort;
 std::map<std::string, std::string> optionNames;
 int iWorldOptPage;
 
+int options_manager::options_version = 0;
+
 options_manager &get_options()
 {
     static options_manager single_instance;
@@ -528,6 +530,7 @@ int options_manager::cOpt::getMaxLength() const
 //set to next item
 void options_manager::cOpt::setNext()
 {
+    changed();
     if (sType == "string_select") {
         int iNext = getItemPos(sSet) + 1;
         if (iNext >= (int)vItems.size()) {
@@ -570,6 +573,7 @@ void options_manager::cOpt::setNext()
 //set to prev item
 void options_manager::cOpt::setPrev()
 {
+    changed();
     if (sType == "string_select") {
         int iPrev = getItemPos(sSet) - 1;
         if (iPrev < 0) {
@@ -611,6 +615,7 @@ void options_manager::cOpt::setPrev()
 //set value
 void options_manager::cOpt::setValue(float fSetIn)
 {
+    changed();
     if (sType != "float") {
         debugmsg("tried to set a float value to a %s option", sType.c_str());
         return;
@@ -624,6 +629,7 @@ void options_manager::cOpt::setValue(float fSetIn)
 //set value
 void options_manager::cOpt::setValue( int iSetIn )
 {
+    changed();
     if( sType != "int" ) {
         debugmsg( "tried to set an int value to a %s option", sType.c_str() );
         return;
@@ -637,6 +643,7 @@ void options_manager::cOpt::setValue( int iSetIn )
 //set value
 void options_manager::cOpt::setValue(std::string sSetIn)
 {
+    changed();
     if (sType == "string_select") {
         if (getItemPos(sSetIn) != -1) {
             sSet = sSetIn;
@@ -762,6 +769,7 @@ std::string options_manager::build_soundpacks_list()
 
 void options_manager::init()
 {
+    changed();
     global_options.clear();
     vPages.clear();
     mPageItems.clear();
@@ -1282,6 +1290,23 @@ void options_manager::init()
         false
         );
 
+    mOptionsSort["debug"]++;
+
+    add("PREFETCH_SUBMAPS", "debug", _("Prefetch map data"),
+        _("If true, the saved map in the direction of travel and around a loaded game is read from disk in the background, which reduces stutter when driving fast and speeds up loading."),
+        true
+        );
+
+    add("SUBMAP_MEMORY_BUDGET", "debug", _("Map memory budget"),
+        _("Approximate maximum memory in megabytes used for loaded map data. Once it is exceeded, the least recently visited areas outside of the reality bubble are saved and unloaded. 0 = unlimited."),
+        0, 65536, 1024
+        );
+
+    add("SKIP_CHECKED_DATA", "debug", _("Skip checking unchanged data"),
+        _("If true, the consistency checks of the game data are skipped when loading data that has passed them before. Changing any data file, mod or world option checks it again."),
+        true
+        );
+
     ////////////////////////////WORLD DEFAULT////////////////////
     add("CORE_VERSION", "world_default", _("Core version data"),
         _("Controls what migrations are applied for legacy worlds"),
@@ -1867,6 +1892,7 @@ void options_manager::show(bool ingame)
             if (ingame && world_options_changed) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            changed();
         }
     }
     if( lang_changed ) {
@@ -150,6 +150,14 @@ class options_manager : public JsonSerializer, public JsonDeserializer
         /** Check if an option exists? */
         bool has_option( const std::string &name ) const;
 
+        /**
+         * Changes whenever the value of any option might have changed, @ref cached_option
+         * looks its option up again then.
+         */
+        static int version() {
+            return options_version;
+        }
+
         cOpt &get_option( const std::string &name );
         cOpt &get_world_option( const std::string &name );
 
@@ -193,6 +201,12 @@ class options_manager : public JsonSerializer, public JsonDeserializer
 
     private:
         std::unordered_map<std::string, cOpt> global_options;
+
+        static int options_version;
+        /** Called by everything that changes option values, see @ref version. */
+        static void changed() {
+            options_version++;
+        }
 };
 
 bool use_narrow_sidebar(); // short-circuits to on if terminal is too small
@@ -224,4 +238,32 @@ inline T get_world_option( const std::string &name )
     return get_options().get_world_option( name ).value_as<T>();
 }
 
+/**
+ * Handle of a (global) option for code that reads it often, e.g. each turn or each frame.
+ * Unlike @ref get_option it only looks the option up after options have been changed.
+ * \code
+ * static const cached_option<bool> autosave( "AUTOSAVE" );
+ * if( autosave.get() ) {
+ * \endcode
+ */
+template<typename T>
+class cached_option
+{
+    public:
+        explicit cached_option( const std::string &name ) : name( name ) {}
+
+        const T &get() const {
+            if( version != options_manager::version() ) {
+                value = get_option<T>( name );
+                version = options_manager::version();
+            }
+            return value;
+        }
+
+    private:
+        std::string name;
+        mutable T value = T();
+        mutable int version = -1;
+};
+
 #endif
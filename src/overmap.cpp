@@ -32,6 +32,7 @@
 #include "mapbuffer.h"
 #include "map_iterator.h"
 #include "messages.h"
+#include "filesystem.h"
 
 #include <cassert>
 #include <stdlib.h>
@@ -43,6 +44,8 @@
 #include <ostream>
 #include <algorithm>
 #include <numeric>
+#include <functional>
+#include <iterator>
 
 #define dbg(x) DebugLog((DebugLevel)(x),D_MAP_GEN) << __FILE__ << ":" << __LINE__ << ": "
 
@@ -296,6 +299,18 @@ bool is_ot_type(const std::string &otype, const oter_id &oter)
     return oter_str.str()[compare_size] == '_';
 }
 
+std::vector<oter_id> find_ot_types(const std::string &otype)
+{
+    std::vector<oter_id> result;
+    for( size_t i = 0; i < oterlist.size(); ++i ) {
+        const oter_id oter( static_cast<int>( i ) );
+        if( is_ot_type( otype, oter ) ) {
+            result.push_back( oter );
+        }
+    }
+    return result;
+}
+
 bool road_allowed(const oter_id &ter)
 {
     return ter->has_flag( allow_road );
@@ -1156,14 +1171,37 @@ void overmap::init_layers()
         for(int i = 0; i < OMAPX; ++i) {
             for(int j = 0; j < OMAPY; ++j) {
                 layer[z].terrain[i][j] = default_type.id();
-                layer[z].visible[i][j] = false;
-                layer[z].explored[i][j] = false;
             }
         }
+        layer[z].visible.reset();
+        layer[z].explored.reset();
+    }
+    terrain_dirty.fill( true );
+    view_dirty.fill( true );
+    for( auto &index : terrain_index ) {
+        index.clear();
+    }
+    clear_glyph_cache( 0, OVERMAP_LAYERS );
+    terrain_chunk_hash.fill( 0 );
+    view_chunk_hash.fill( 0 );
+    main_hash = 0;
+}
+
+int overmap::chunk_first_layer( const int chunk )
+{
+    switch( chunk ) {
+        case 0:
+            return 0;
+        case 1:
+            return OVERMAP_DEPTH;
+        case 2:
+            return OVERMAP_DEPTH + 1;
+        default:
+            return OVERMAP_LAYERS;
     }
 }
 
-oter_id &overmap::ter(const int x, const int y, const int z)
+const oter_id &overmap::get_ter(const int x, const int y, const int z) const
 {
     if( !inbounds( x, y, z ) ) {
         return ot_null;
@@ -1172,31 +1210,52 @@ oter_id &overmap::ter(const int x, const int y, const int z)
     return layer[z + OVERMAP_DEPTH].terrain[x][y];
 }
 
-const oter_id overmap::get_ter(const int x, const int y, const int z) const
+void overmap::set_ter( const int x, const int y, const int z, const oter_id &id )
 {
     if( !inbounds( x, y, z ) ) {
-        return ot_null;
+        return;
     }
-
-    return layer[z + OVERMAP_DEPTH].terrain[x][y];
+    oter_id &current = layer[z + OVERMAP_DEPTH].terrain[x][y];
+    if( current == id ) {
+        return;
+    }
+    terrain_dirty[z + OVERMAP_DEPTH] = true;
+    invalidate_glyph( x, y, z );
+    auto &index = terrain_index[z + OVERMAP_DEPTH];
+    if( !index.empty() ) {
+        const point p( x, y );
+        if( static_cast<size_t>( current ) < index.size() ) {
+            auto &positions = index[current];
+            const auto iter = std::find( positions.begin(), positions.end(), p );
+            if( iter != positions.end() ) {
+                // The order of the positions doesn't matter.
+                *iter = positions.back();
+                positions.pop_back();
+            }
+        }
+        if( static_cast<size_t>( id ) < index.size() ) {
+            index[id].push_back( p );
+        }
+    }
+    current = id;
 }
 
-bool &overmap::seen(int x, int y, int z)
+bool overmap::seen(int x, int y, int z) const
 {
     if( !inbounds( x, y, z ) ) {
-        nullbool = false;
-        return nullbool;
+        return false;
     }
-    return layer[z + OVERMAP_DEPTH].visible[x][y];
+    return layer[z + OVERMAP_DEPTH].visible[map_layer::tile( x, y )];
 }
 
-bool &overmap::explored(int x, int y, int z)
+void overmap::set_seen(int x, int y, int z, bool seen)
 {
     if( !inbounds( x, y, z ) ) {
-        nullbool = false;
-        return nullbool;
+        return;
     }
-    return layer[z + OVERMAP_DEPTH].explored[x][y];
+    view_dirty[z + OVERMAP_DEPTH] = true;
+    invalidate_glyph( x, y, z );
+    layer[z + OVERMAP_DEPTH].visible[map_layer::tile( x, y )] = seen;
 }
 
 bool overmap::is_explored(int const x, int const y, int const z) const
@@ -1204,24 +1263,33 @@ bool overmap::is_explored(int const x, int const y, int const z) const
     if( !inbounds( x, y, z ) ) {
         return false;
     }
-    return layer[z + OVERMAP_DEPTH].explored[x][y];
+    return layer[z + OVERMAP_DEPTH].explored[map_layer::tile( x, y )];
+}
+
+void overmap::set_explored(int x, int y, int z, bool explored)
+{
+    if( !inbounds( x, y, z ) ) {
+        return;
+    }
+    view_dirty[z + OVERMAP_DEPTH] = true;
+    invalidate_glyph( x, y, z );
+    layer[z + OVERMAP_DEPTH].explored[map_layer::tile( x, y )] = explored;
 }
 
 bool overmap::mongroup_check(const mongroup &candidate) const
 {
-    const auto matching_range = zg.equal_range(candidate.pos);
-    return std::find_if( matching_range.first, matching_range.second,
-        [candidate](std::pair<tripoint, mongroup> match) {
+    return std::any_of( zg.begin(), zg.end(),
+        [&candidate](const mongroup &match) {
             // This is extra strict since we're using it to test serialization.
-            return candidate.type == match.second.type && candidate.pos == match.second.pos &&
-                candidate.radius == match.second.radius &&
-                candidate.population == match.second.population &&
-                candidate.target == match.second.target &&
-                candidate.interest == match.second.interest &&
-                candidate.dying == match.second.dying &&
-                candidate.horde == match.second.horde &&
-                candidate.diffuse == match.second.diffuse;
-        } ) != matching_range.second;
+            return candidate.type == match.type && candidate.pos == match.pos &&
+                candidate.radius == match.radius &&
+                candidate.population == match.population &&
+                candidate.target == match.target &&
+                candidate.interest == match.interest &&
+                candidate.dying == match.dying &&
+                candidate.horde == match.horde &&
+                candidate.diffuse == match.diffuse;
+        } );
 }
 
 bool overmap::monster_check(const std::pair<tripoint, monster> &candidate) const
@@ -1240,6 +1308,63 @@ void overmap::add_npc( npc &who )
     g->set_npcs_dirty();
 }
 
+static_assert( OMAPX == OMAPY, "overmap glyph chunks assume square overmaps" );
+
+void overmap::invalidate_glyph( const int x, const int y, const int z ) const
+{
+    const int chunk_x = x / glyph_chunk_size;
+    const int chunk_y = y / glyph_chunk_size;
+    glyph_cache[( ( z + OVERMAP_DEPTH ) * glyph_chunks + chunk_x ) * glyph_chunks + chunk_y].clear();
+}
+
+void overmap::clear_glyph_cache( const int first_layer, const int last_layer ) const
+{
+    const int per_layer = glyph_chunks * glyph_chunks;
+    for( int i = first_layer * per_layer; i < last_layer * per_layer; i++ ) {
+        glyph_cache[i].clear();
+    }
+}
+
+const overmap::tile_glyph &overmap::get_tile_glyph( const int x, const int y, const int z ) const
+{
+    const int chunk_x = x / glyph_chunk_size;
+    const int chunk_y = y / glyph_chunk_size;
+    auto &chunk = glyph_cache[( ( z + OVERMAP_DEPTH ) * glyph_chunks + chunk_x ) * glyph_chunks + chunk_y];
+    const int min_x = chunk_x * glyph_chunk_size;
+    const int min_y = chunk_y * glyph_chunk_size;
+    if( chunk.empty() ) {
+        chunk.resize( glyph_chunk_size * glyph_chunk_size );
+        const map_layer &l = layer[z + OVERMAP_DEPTH];
+        for( int i = 0; i < glyph_chunk_size; i++ ) {
+            for( int j = 0; j < glyph_chunk_size; j++ ) {
+                tile_glyph &glyph = chunk[i * glyph_chunk_size + j];
+                const oter_t &info = l.terrain[min_x + i][min_y + j].obj();
+                glyph.sym = info.sym;
+                glyph.color = info.color;
+                glyph.seen = l.visible[map_layer::tile( min_x + i, min_y + j )];
+                glyph.explored = l.explored[map_layer::tile( min_x + i, min_y + j )];
+            }
+        }
+        const auto in_chunk = [min_x, min_y]( const int px, const int py ) {
+            return px >= min_x && px < min_x + glyph_chunk_size &&
+                   py >= min_y && py < min_y + glyph_chunk_size;
+        };
+        for( const om_note &note : l.notes ) {
+            if( in_chunk( note.x, note.y ) ) {
+                chunk[( note.x - min_x ) * glyph_chunk_size + note.y - min_y].has_note = true;
+            }
+        }
+        if( z == 0 ) {
+            for( const auto &veh : vehicles ) {
+                if( in_chunk( veh.second.x, veh.second.y ) ) {
+                    chunk[( veh.second.x - min_x ) * glyph_chunk_size + veh.second.y - min_y].has_vehicle = true;
+                }
+            }
+        }
+    }
+    return chunk[( x - min_x ) * glyph_chunk_size + y - min_y];
+}
+
 bool overmap::has_note(int const x, int const y, int const z) const
 {
     if (z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT) {
@@ -1277,6 +1402,10 @@ void overmap::add_note(int const x, int const y, int const z, std::string messag
         return;
     }
 
+    view_dirty[z + OVERMAP_DEPTH] = true;
+    if( inbounds( x, y, z ) ) {
+        invalidate_glyph( x, y, z );
+    }
     auto &notes = layer[z + OVERMAP_DEPTH].notes;
     auto const it = std::find_if(begin(notes), end(notes), [&](om_note const& n) {
         return n.x == x && n.y == y;
@@ -1388,20 +1517,104 @@ point overmap::display_notes(int z)
     return result;
 }
 
-const scent_trace &overmap::scent_at( const tripoint &loc ) const
+// Scent that is weaker than this is gone.
+static const float min_scent = 1.0f;
+
+scent_trace overmap::scent_at( const tripoint &loc ) const
 {
-    const static scent_trace null_scent;
-    const auto &scent_found = scents.find( loc );
-    if( scent_found != scents.end() ) {
-        return scent_found->second;
+    const point base = global_base_point();
+    const int x = loc.x - base.x;
+    const int y = loc.y - base.y;
+    const auto layer_found = scents.find( loc.z );
+    if( layer_found == scents.end() || !inbounds( x, y, loc.z ) ) {
+        return scent_trace();
+    }
+    const size_t i = x * OMAPY + y;
+    const scent_layer &layer = layer_found->second;
+    if( layer.turn[i] < 0 ) {
+        return scent_trace();
     }
-    return null_scent;
+    return scent_trace( layer.turn[i], static_cast<int>( layer.strength[i] ) );
 }
 
 void overmap::set_scent( const tripoint &loc, scent_trace &new_scent )
 {
+    const point base = global_base_point();
+    const int x = loc.x - base.x;
+    const int y = loc.y - base.y;
+    if( !inbounds( x, y, loc.z ) || new_scent.initial_strength < min_scent ) {
+        return;
+    }
     // TODO: increase strength of scent trace when applied repeatedlu in a short timespan.
-    scents[loc] = new_scent;
+    scent_layer &layer = scents[loc.z];
+    const size_t i = x * OMAPY + y;
+    layer.strength[i] = std::max( layer.strength[i], static_cast<float>( new_scent.initial_strength ) );
+    layer.turn[i] = new_scent.creation_turn;
+}
+
+void overmap::diffuse_scents()
+{
+    // Share of the scent that goes to the 4 adjacent tiles in each step, and how much
+    // of it is left after the step.
+    static const float spread = 0.2f;
+    static const float fade = 0.95f;
+    static const std::vector<float> no_scent( OMAPY, 0.0f );
+
+    std::vector<float> next( OMAPX * OMAPY );
+    for( auto it = scents.begin(); it != scents.end(); ) {
+        scent_layer &layer = it->second;
+        const std::vector<float> &cur = layer.strength;
+        // Scent beyond the edge of the overmap is lost.
+        for( int x = 0; x < OMAPX; x++ ) {
+            const float *const row = &cur[x * OMAPY];
+            const float *const west = x > 0 ? &cur[( x - 1 ) * OMAPY] : no_scent.data();
+            const float *const east = x < OMAPX - 1 ? &cur[( x + 1 ) * OMAPY] : no_scent.data();
+            float *const out = &next[x * OMAPY];
+            for( int y = 0; y < OMAPY; y++ ) {
+                const float north = y > 0 ? row[y - 1] : 0.0f;
+                const float south = y < OMAPY - 1 ? row[y + 1] : 0.0f;
+                out[y] = fade * ( ( 1.0f - spread ) * row[y] +
+                                  spread * 0.25f * ( west[y] + east[y] + north + south ) );
+            }
+        }
+
+        bool any_left = false;
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const size_t i = x * OMAPY + y;
+                if( next[i] < min_scent ) {
+                    next[i] = 0.0f;
+                    layer.turn[i] = -1;
+                    continue;
+                }
+                any_left = true;
+                if( layer.turn[i] >= 0 ) {
+                    continue;
+                }
+                // Scent that just spread here is as old as the newest one next to it.
+                int turn = -1;
+                if( x > 0 ) {
+                    turn = std::max( turn, layer.turn[i - OMAPY] );
+                }
+                if( x < OMAPX - 1 ) {
+                    turn = std::max( turn, layer.turn[i + OMAPY] );
+                }
+                if( y > 0 ) {
+                    turn = std::max( turn, layer.turn[i - 1] );
+                }
+                if( y < OMAPY - 1 ) {
+                    turn = std::max( turn, layer.turn[i + 1] );
+                }
+                layer.turn[i] = turn;
+            }
+        }
+        if( !any_left ) {
+            it = scents.erase( it );
+            continue;
+        }
+        layer.strength.swap( next );
+        ++it;
+    }
 }
 
 void overmap::generate(const overmap *north, const overmap *east,
@@ -1418,7 +1631,7 @@ void overmap::generate(const overmap *north, const overmap *east,
     if (north != NULL) {
         for (int i = 2; i < OMAPX - 2; i++) {
             if (is_river(north->get_ter(i, OMAPY - 1, 0))) {
-                ter(i, 0, 0) = river_center;
+                set_ter(i, 0, 0, river_center);
             }
             if (is_river(north->get_ter(i, OMAPY - 1, 0)) &&
                 is_river(north->get_ter(i - 1, OMAPY - 1, 0)) &&
@@ -1439,7 +1652,7 @@ void overmap::generate(const overmap *north, const overmap *east,
     if (west != NULL) {
         for (int i = 2; i < OMAPY - 2; i++) {
             if (is_river(west->get_ter(OMAPX - 1, i, 0))) {
-                ter(0, i, 0) = river_center;
+                set_ter(0, i, 0, river_center);
             }
             if (is_river(west->get_ter(OMAPX - 1, i, 0)) &&
                 is_river(west->get_ter(OMAPX - 1, i - 1, 0)) &&
@@ -1459,7 +1672,7 @@ void overmap::generate(const overmap *north, const overmap *east,
     if (south != NULL) {
         for (int i = 2; i < OMAPX - 2; i++) {
             if (is_river(south->get_ter(i, 0, 0))) {
-                ter(i, OMAPY - 1, 0) = river_center;
+                set_ter(i, OMAPY - 1, 0, river_center);
             }
             if (is_river(south->get_ter(i,     0, 0)) &&
                 is_river(south->get_ter(i - 1, 0, 0)) &&
@@ -1483,7 +1696,7 @@ void overmap::generate(const overmap *north, const overmap *east,
     if (east != NULL) {
         for (int i = 2; i < OMAPY - 2; i++) {
             if (is_river(east->get_ter(0, i, 0))) {
-                ter(OMAPX - 1, i, 0) = river_center;
+                set_ter(OMAPX - 1, i, 0, river_center);
             }
             if (is_river(east->get_ter(0, i, 0)) &&
                 is_river(east->get_ter(0, i - 1, 0)) &&
@@ -1579,29 +1792,29 @@ void overmap::generate(const overmap *north, const overmap *east,
         if (north == NULL) {
             do {
                 tmp = rng(10, OMAPX - 11);
-            } while (is_river(ter(tmp, 0, 0)) || is_river(ter(tmp - 1, 0, 0)) ||
-                     is_river(ter(tmp + 1, 0, 0)) );
+            } while (is_river(get_ter(tmp, 0, 0)) || is_river(get_ter(tmp - 1, 0, 0)) ||
+                     is_river(get_ter(tmp + 1, 0, 0)) );
             viable_roads.push_back(city(tmp, 0, 0));
         }
         if (east == NULL) {
             do {
                 tmp = rng(10, OMAPY - 11);
-            } while (is_river(ter(OMAPX - 1, tmp, 0)) || is_river(ter(OMAPX - 1, tmp - 1, 0)) ||
-                     is_river(ter(OMAPX - 1, tmp + 1, 0)));
+            } while (is_river(get_ter(OMAPX - 1, tmp, 0)) || is_river(get_ter(OMAPX - 1, tmp - 1, 0)) ||
+                     is_river(get_ter(OMAPX - 1, tmp + 1, 0)));
             viable_roads.push_back(city(OMAPX - 1, tmp, 0));
         }
         if (south == NULL) {
             do {
                 tmp = rng(10, OMAPX - 11);
-            } while (is_river(ter(tmp, OMAPY - 1, 0)) || is_river(ter(tmp - 1, OMAPY - 1, 0)) ||
-                     is_river(ter(tmp + 1, OMAPY - 1, 0)));
+            } while (is_river(get_ter(tmp, OMAPY - 1, 0)) || is_river(get_ter(tmp - 1, OMAPY - 1, 0)) ||
+                     is_river(get_ter(tmp + 1, OMAPY - 1, 0)));
             viable_roads.push_back(city(tmp, OMAPY - 1, 0));
         }
         if (west == NULL) {
             do {
                 tmp = rng(10, OMAPY - 11);
-            } while (is_river(ter(0, tmp, 0)) || is_river(ter(0, tmp - 1, 0)) ||
-                     is_river(ter(0, tmp + 1, 0)));
+            } while (is_river(get_ter(0, tmp, 0)) || is_river(get_ter(0, tmp - 1, 0)) ||
+                     is_river(get_ter(0, tmp + 1, 0)));
             viable_roads.push_back(city(0, tmp, 0));
         }
         while (roads_out.size() < 2 && !viable_roads.empty()) {
@@ -1658,7 +1871,7 @@ bool overmap::generate_sub(int const z)
 
     for (int i = 0; i < OMAPX; i++) {
         for (int j = 0; j < OMAPY; j++) {
-            oter_id oter_above = ter(i, j, z + 1);
+            oter_id oter_above = get_ter(i, j, z + 1);
 
             // implicitly skip skip_above oter_ids
             bool skipme = false;
@@ -1674,24 +1887,24 @@ bool overmap::generate_sub(int const z)
             }
 
             if (is_ot_type("house_base", oter_above)) {
-                ter(i, j, z) = oter_id( "basement" );
+                set_ter(i, j, z, oter_id( "basement" ));
             } else if (is_ot_type("sub_station", oter_above)) {
-                ter(i, j, z) = oter_id( "subway_nesw" );
+                set_ter(i, j, z, oter_id( "subway_nesw" ));
                 subway_points.push_back(city(i, j, 0));
             } else if (oter_above == "road_nesw_manhole") {
-                ter(i, j, z) = oter_id( "sewer_nesw" );
+                set_ter(i, j, z, oter_id( "sewer_nesw" ));
                 sewer_points.push_back(city(i, j, 0));
             } else if (oter_above == "sewage_treatment") {
                 sewer_points.push_back(city(i, j, 0));
             } else if (oter_above == "cave" && z == -1) {
                 if (one_in(3)) {
-                    ter(i, j, z) = oter_id( "cave_rat" );
+                    set_ter(i, j, z, oter_id( "cave_rat" ));
                     requires_sub = true; // rat caves are two level
                 } else {
-                    ter(i, j, z) = oter_id( "cave" );
+                    set_ter(i, j, z, oter_id( "cave" ));
                 }
             } else if (oter_above == "cave_rat" && z == -2) {
-                ter(i, j, z) = oter_id( "cave_rat" );
+                set_ter(i, j, z, oter_id( "cave_rat" ));
             } else if (oter_above == "anthill") {
                 int size = rng(MIN_ANT_SIZE, MAX_ANT_SIZE);
                 ant_points.push_back(city(i, j, size));
@@ -1700,38 +1913,38 @@ bool overmap::generate_sub(int const z)
                 int size = rng(MIN_GOO_SIZE, MAX_GOO_SIZE);
                 goo_points.push_back(city(i, j, size));
             } else if (oter_above == "forest_water") {
-                ter(i, j, z) = oter_id( "cavern" );
+                set_ter(i, j, z, oter_id( "cavern" ));
                 chip_rock( i, j, z );
             } else if (oter_above == "lab_core" ||
                        (z == -1 && oter_above == "lab_stairs")) {
                 lab_points.push_back(city(i, j, rng(1, 5 + z)));
             } else if (oter_above == "lab_stairs") {
-                ter(i, j, z) = oter_id( "lab" );
+                set_ter(i, j, z, oter_id( "lab" ));
             } else if (oter_above == "ice_lab_core" ||
                        (z == -1 && oter_above == "ice_lab_stairs")) {
                 ice_lab_points.push_back(city(i, j, rng(1, 5 + z)));
             } else if (oter_above == "ice_lab_stairs") {
-                ter(i, j, z) = oter_id( "ice_lab" );
+                set_ter(i, j, z, oter_id( "ice_lab" ));
             } else if (oter_above == "mine_entrance") {
                 shaft_points.push_back( point(i, j) );
             } else if (oter_above == "mine_shaft" ||
                        oter_above == "mine_down"    ) {
-                ter(i, j, z) = oter_id( "mine" );
+                set_ter(i, j, z, oter_id( "mine" ));
                 mine_points.push_back(city(i, j, rng(6 + z, 10 + z)));
                 // technically not all finales need a sub level,
                 // but at this point we don't know
                 requires_sub = true;
             } else if( oter_above == "mine_finale" ) {
                 for( auto &p : g->m.points_in_radius( tripoint( i, j, z ), 1, 0 ) ) {
-                    ter( p.x, p.y, p.z ) = oter_id( "spiral" );
+                    set_ter( p.x, p.y, p.z, oter_id( "spiral" ) );
                 }
-                ter( i, j, z ) = oter_id( "spiral_hub" );
+                set_ter( i, j, z, oter_id( "spiral_hub" ) );
                 add_mon_group( mongroup( mongroup_id( "GROUP_SPIRAL" ), i * 2, j * 2, z, 2, 200 ) );
             } else if ( oter_above == "silo" ) {
                 if (rng(2, 7) < abs(z) || rng(2, 7) < abs(z)) {
-                    ter(i, j, z) = oter_id( "silo_finale" );
+                    set_ter(i, j, z, oter_id( "silo_finale" ));
                 } else {
-                    ter(i, j, z) = oter_id( "silo" );
+                    set_ter(i, j, z, oter_id( "silo" ));
                     requires_sub = true;
                 }
             }
@@ -1745,20 +1958,20 @@ bool overmap::generate_sub(int const z)
     polish(z, "sewer");
     place_hiways(subway_points, z, "subway");
     for (auto &i : subway_points) {
-        ter(i.x, i.y, z) = oter_id( "subway_station" );
+        set_ter(i.x, i.y, z, oter_id( "subway_station" ));
     }
     for (auto &i : lab_points) {
         bool lab = build_lab(i.x, i.y, z, i.s);
         requires_sub |= lab;
-        if (!lab && ter(i.x, i.y, z) == "lab_core") {
-            ter(i.x, i.y, z) = oter_id( "lab" );
+        if (!lab && get_ter(i.x, i.y, z) == "lab_core") {
+            set_ter(i.x, i.y, z, oter_id( "lab" ));
         }
     }
     for (auto &i : ice_lab_points) {
         bool ice_lab = build_lab(i.x, i.y, z, i.s, true);
         requires_sub |= ice_lab;
-        if (!ice_lab && ter(i.x, i.y, z) == "ice_lab_core") {
-            ter(i.x, i.y, z) = oter_id( "ice_lab" );
+        if (!ice_lab && get_ter(i.x, i.y, z) == "ice_lab_core") {
+            set_ter(i.x, i.y, z, oter_id( "ice_lab" ));
         }
     }
     for (auto &i : ant_points) {
@@ -1782,7 +1995,7 @@ bool overmap::generate_sub(int const z)
     }
 
     for (auto &i : shaft_points) {
-        ter(i.x, i.y, z) = oter_id( "mine_shaft" );
+        set_ter(i.x, i.y, z, oter_id( "mine_shaft" ));
         requires_sub = true;
     }
     return requires_sub;
@@ -1794,7 +2007,7 @@ std::vector<point> overmap::find_terrain(const std::string &term, int zlevel)
     for (int x = 0; x < OMAPX; x++) {
         for (int y = 0; y < OMAPY; y++) {
             if (seen(x, y, zlevel) &&
-                lcmatch( ter(x, y, zlevel)->name, term ) ) {
+                lcmatch( get_ter(x, y, zlevel)->name, term ) ) {
                 found.push_back( global_base_point() + point( x, y ) );
             }
         }
@@ -1802,6 +2015,40 @@ std::vector<point> overmap::find_terrain(const std::string &term, int zlevel)
     return found;
 }
 
+const std::vector<std::vector<point>> &overmap::get_terrain_index( const int z ) const
+{
+    auto &index = terrain_index[z + OVERMAP_DEPTH];
+    if( index.empty() ) {
+        index.resize( oterlist.size() );
+        const map_layer &l = layer[z + OVERMAP_DEPTH];
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const size_t type = l.terrain[x][y];
+                if( type < index.size() ) {
+                    index[type].push_back( point( x, y ) );
+                }
+            }
+        }
+    }
+    return index;
+}
+
+std::vector<point> overmap::find_ot_types( const std::vector<oter_id> &types, const int z ) const
+{
+    std::vector<point> found;
+    if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
+        return found;
+    }
+    const auto &index = get_terrain_index( z );
+    for( const oter_id &type : types ) {
+        if( static_cast<size_t>( type ) < index.size() ) {
+            const auto &positions = index[type];
+            found.insert( found.end(), positions.begin(), positions.end() );
+        }
+    }
+    return found;
+}
+
 const city &overmap::get_nearest_city( const tripoint &p ) const
 {
     int distance = 999;
@@ -1985,11 +2232,9 @@ void overmap::draw(WINDOW *w, WINDOW *wbar, const tripoint &center,
         }
     }
 
-    // A small LRU cache: most oter_id's occur in clumps like forests of swamps.
-    // This cache helps avoid much more costly lookups in the full hashmap.
-    constexpr size_t cache_size = 8; // used below to calculate the next index
-    std::array<std::pair<oter_id, oter_t const*>, cache_size> cache {{}};
-    size_t cache_next = 0;
+    // The window shows at most four overmaps, remember the last one looked up.
+    point last_om_pos( INT_MIN, INT_MIN );
+    const overmap *last_om = nullptr;
 
     int const offset_x = cursx - om_half_width;
     int const offset_y = cursy - om_half_height;
@@ -2055,10 +2300,23 @@ void overmap::draw(WINDOW *w, WINDOW *wbar, const tripoint &center,
             nc_color ter_color = c_black;
             long ter_sym = ' ';
 
-            const bool see = has_debug_vision || overmap_buffer.seen(omx, omy, z);
+            int localx = omx;
+            int localy = omy;
+            const point om_pos = omt_to_om_remain( localx, localy );
+            if( om_pos != last_om_pos ) {
+                last_om_pos = om_pos;
+                // Debug vision shows (and therefore generates) everything, otherwise
+                // overmaps that do not exist yet can not have been seen.
+                last_om = has_debug_vision ? &overmap_buffer.get( om_pos.x, om_pos.y ) :
+                          overmap_buffer.get_existing( om_pos.x, om_pos.y );
+            }
+            static const tile_glyph unknown_glyph;
+            const tile_glyph &glyph = last_om != nullptr ?
+                                      last_om->get_tile_glyph( localx, localy, z ) : unknown_glyph;
+
+            const bool see = has_debug_vision || glyph.seen;
             if (see) {
-                // Only load terrain if we can actually see it
-                cur_ter = overmap_buffer.ter(omx, omy, z);
+                cur_ter = last_om->get_ter( localx, localy, z );
             }
 
             tripoint const cur_pos {omx, omy, z};
@@ -2081,10 +2339,10 @@ void overmap::draw(WINDOW *w, WINDOW *wbar, const tripoint &center,
                 } else if( target.z < z ) {
                     ter_sym = 'v';
                 }
-            } else if (blink && overmap_buffer.has_note(cur_pos)) {
+            } else if( blink && glyph.has_note ) {
                 // Display notes in all situations, even when not seen
                 std::tie(ter_sym, ter_color, std::ignore) =
-                    get_note_display_info(overmap_buffer.note(cur_pos));
+                    get_note_display_info( last_om->note( localx, localy, z ) );
             } else if (!see) {
                 // All cases above ignore the seen-status,
                 ter_color = c_dkgray;
@@ -2098,7 +2356,7 @@ void overmap::draw(WINDOW *w, WINDOW *wbar, const tripoint &center,
                 // Display Hordes only when within player line-of-sight
                 ter_color = c_green;
                 ter_sym   = 'Z';
-            } else if (blink && overmap_buffer.has_vehicle(omx, omy, z)) {
+            } else if( blink && glyph.has_vehicle ) {
                 // Display Vehicles only when player can see the location
                 ter_color = c_cyan;
                 ter_sym   = 'c';
@@ -2107,47 +2365,16 @@ void overmap::draw(WINDOW *w, WINDOW *wbar, const tripoint &center,
                 ter_sym   = 'Z';
             } else {
                 // Nothing special, but is visible to the player.
-                // First see if we have the oter_t cached
-                oter_t const* info = nullptr;
-                for (auto const &c : cache) {
-                    if (c.first == cur_ter) {
-                        info = c.second;
-                        break;
-                    }
-                }
-                // Nope, look in the hash map next
-                if (!info) {
-                    auto const it = otermap.find( cur_ter.id() );
-                    if( it == otermap.end() ) {
-                        debugmsg( "Bad ter %s (%d, %d)", cur_ter.id().c_str(), omx, omy );
-                        ter_color = c_red;
-                        ter_sym   = '?';
-                    } else {
-                        // cache the new value
-                        info = &it->second;
-                        cache[cache_next] = std::make_pair( cur_ter, info );
-                        cache_next = ( cache_next + 1 ) % cache_size;
-                    }
-                }
-                // Ok, we found something
-                if (info) {
-                    // Map tile marked as explored
-                    bool const explored = show_explored && overmap_buffer.is_explored(omx, omy, z);
-                    ter_color = explored ? c_dkgray : info->color;
-                    ter_sym   = info->sym;
-                }
+                // Map tile marked as explored
+                ter_color = show_explored && glyph.explored ? c_dkgray : glyph.color;
+                ter_sym   = glyph.sym;
             }
 
             // Are we debugging monster groups?
             if(blink && data.debug_mongroup) {
                 // Check if this tile is the target of the currently selected group
 
-                // Convert to position within overmap
-                int localx = omx * 2;
-                int localy = omy * 2;
-                sm_to_om_remain(localx, localy);
-
-                if(mgroup && mgroup->target.x / 2 == localx / 2 && mgroup->target.y / 2 == localy / 2) {
+                if( mgroup && mgroup->target.x / 2 == localx && mgroup->target.y / 2 == localy ) {
                     ter_color = c_red;
                     ter_sym = 'x';
                 } else {
@@ -2701,13 +2928,13 @@ tripoint overmap::draw_overmap(const tripoint &orig, const draw_data_t &data)
                         curs.y += diry;
                     } else if( action == "CONFIRM" ) { // Actually modify the overmap
                         if( terrain ) {
-                            overmap_buffer.ter( curs ) = uistate.place_terrain->id.id();
+                            overmap_buffer.set_ter( curs, uistate.place_terrain->id.id() );
                             overmap_buffer.set_seen( curs.x, curs.y, curs.z, true );
                         } else {
                             for( const auto &s_ter : uistate.place_special->terrains ) {
                                 const tripoint pos = curs + om_direction::rotate( s_ter.p, uistate.omedit_rotation );
 
-                                overmap_buffer.ter( pos ) = om_direction::rotate( s_ter.terrain, uistate.omedit_rotation );
+                                overmap_buffer.set_ter( pos, om_direction::rotate( s_ter.terrain, uistate.omedit_rotation ) );
                                 overmap_buffer.set_seen( pos.x, pos.y, pos.z, true );
                             }
                         }
@@ -2763,18 +2990,15 @@ tripoint overmap::find_random_omt( const std::string &omt_base_type ) const
 
 void overmap::process_mongroups()
 {
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+    zg.update_all( []( mongroup &mg ) {
         if( mg.dying ) {
             mg.population = (mg.population * 4) / 5;
             mg.radius = (mg.radius * 9) / 10;
         }
-        if( mg.empty() ) {
-            zg.erase( it++ );
-        } else {
-            ++it;
-        }
-    }
+    } );
+    zg.remove_if( []( const mongroup &mg ) {
+        return mg.empty();
+    } );
 }
 
 void overmap::clear_mon_groups()
@@ -2787,7 +3011,7 @@ void mongroup::wander( overmap &om )
     const city *target_city = nullptr;
     int target_distance = 0;
 
-    if( horde_behaviour == "city" ) {
+    if( horde_behaviour == behaviour::city ) {
         // Find a nearby city to return to..
         for(const city &check_city : om.cities ) {
             // Check if this is the nearest city so far.
@@ -2815,63 +3039,82 @@ void mongroup::wander( overmap &om )
 
 void overmap::move_hordes()
 {
-    // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype(zg) tmpzg;
-    //MOVE ZOMBIE GROUPS
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
-        if( !mg.horde ) {
-            ++it;
-            continue;
-        }
+    // Hordes with a scent this strong (or stronger) next to them follow it.
+    static const float horde_scent_threshold = 50.0f;
+    diffuse_scents();
 
-        if(mg.horde_behaviour == "") {
-            mg.horde_behaviour = one_in(2) ? "city" : "roam";
-        }
-
-        // Gradually decrease interest.
-        mg.dec_interest( 1 );
+    //MOVE ZOMBIE GROUPS
+    for( size_t i = 0; i < zg.size(); i++ ) {
+        zg.update( i, [this]( mongroup &mg ) {
+            if( !mg.horde ) {
+                return;
+            }
 
-        if( (mg.pos.x == mg.target.x && mg.pos.y == mg.target.y) || mg.interest <= 15 ) {
-            mg.wander(*this);
-        }
+            if( mg.horde_behaviour == mongroup::behaviour::none ) {
+                mg.horde_behaviour = one_in( 2 ) ? mongroup::behaviour::city : mongroup::behaviour::roam;
+            }
 
-        // Decrease movement chance according to the terrain we're currently on.
-        const oter_id& walked_into = ter(mg.pos.x, mg.pos.y, mg.pos.z);
-        int movement_chance = 1;
-        if(walked_into == ot_forest || walked_into == ot_forest_water) {
-            movement_chance = 3;
-        } else if(walked_into == ot_forest_thick) {
-            movement_chance = 6;
-        } else if(walked_into == ot_river_center) {
-            movement_chance = 10;
-        }
+            // Gradually decrease interest.
+            mg.dec_interest( 1 );
 
-        if( one_in(movement_chance) && rng(0, 100) < mg.interest ) {
-            // TODO: Adjust for monster speed.
-            // TODO: Handle moving to adjacent overmaps.
-            if( mg.pos.x > mg.target.x) {
-                mg.pos.x--;
-            }
-            if( mg.pos.x < mg.target.x) {
-                mg.pos.x++;
+            if( (mg.pos.x == mg.target.x && mg.pos.y == mg.target.y) || mg.interest <= 15 ) {
+                mg.wander(*this);
             }
-            if( mg.pos.y > mg.target.y) {
-                mg.pos.y--;
+
+            // Follow the scent towards where it's strongest.
+            const auto scent_found = scents.find( mg.pos.z );
+            // Hordes that left the overmap can have negative positions.
+            const point omt = sm_to_omt_copy( mg.pos.x, mg.pos.y );
+            if( scent_found != scents.end() && inbounds( omt.x, omt.y, mg.pos.z ) ) {
+                const std::vector<float> &strength = scent_found->second.strength;
+                float best = strength[omt.x * OMAPY + omt.y];
+                point best_omt = omt;
+                for( int dx = -1; dx <= 1; dx++ ) {
+                    for( int dy = -1; dy <= 1; dy++ ) {
+                        const point p( omt.x + dx, omt.y + dy );
+                        if( inbounds( p.x, p.y, mg.pos.z ) && strength[p.x * OMAPY + p.y] > best ) {
+                            best = strength[p.x * OMAPY + p.y];
+                            best_omt = p;
+                        }
+                    }
+                }
+                if( best >= horde_scent_threshold && best_omt != omt ) {
+                    mg.set_target( best_omt.x * 2, best_omt.y * 2 );
+                    mg.set_interest( std::max( mg.interest, 60 ) );
+                }
             }
-            if( mg.pos.y < mg.target.y) {
-                mg.pos.y++;
+
+            // Decrease movement chance according to the terrain we're currently on.
+            // The position is in submaps, the terrain in overmap terrain coordinates.
+            const oter_id walked_into = get_ter( omt.x, omt.y, mg.pos.z );
+            int movement_chance = 1;
+            if(walked_into == ot_forest || walked_into == ot_forest_water) {
+                movement_chance = 3;
+            } else if(walked_into == ot_forest_thick) {
+                movement_chance = 6;
+            } else if(walked_into == ot_river_center) {
+                movement_chance = 10;
             }
 
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.insert( std::pair<tripoint, mongroup>( mg.pos, mg ) );
-            zg.erase( it++ );
-        } else {
-            ++it;
-        }
+            if( one_in(movement_chance) && rng(0, 100) < mg.interest ) {
+                // TODO: Adjust for monster speed.
+                tripoint pos = mg.pos;
+                if( pos.x > mg.target.x) {
+                    pos.x--;
+                }
+                if( pos.x < mg.target.x) {
+                    pos.x++;
+                }
+                if( pos.y > mg.target.y) {
+                    pos.y--;
+                }
+                if( pos.y < mg.target.y) {
+                    pos.y++;
+                }
+                mg.pos = pos;
+            }
+        } );
     }
-    // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
 
 
     if(get_world_option<bool>( "WANDER_SPAWNS" ) ) {
@@ -2904,16 +3147,12 @@ void overmap::move_hordes()
 
             // Scan for compatible hordes in this area.
             mongroup *add_to_group = NULL;
-            auto group_bucket = zg.equal_range(p);
-            std::for_each( group_bucket.first, group_bucket.second,
-                [&](std::pair<const tripoint, mongroup> &horde_entry ) {
-                mongroup &horde = horde_entry.second;
-
+            for( mongroup *horde : zg.at( p ) ) {
                 // We only absorb zombies into GROUP_ZOMBIE hordes
-                if(horde.horde && !horde.monsters.empty() && horde.type == GROUP_ZOMBIE) {
-                    add_to_group = &horde;
+                if(horde->horde && !horde->monsters.empty() && horde->type == GROUP_ZOMBIE) {
+                    add_to_group = horde;
                 }
-            });
+            }
 
             // If there is no horde to add the monster to, create one.
             if(add_to_group == NULL) {
@@ -2932,19 +3171,45 @@ void overmap::move_hordes()
     }
 }
 
+void overmap::wander_monsters( const point &bubble_min, const int bubble_size )
+{
+    std::vector<std::pair<tripoint, monster>> moved;
+    for( auto it = monster_map.begin(); it != monster_map.end(); ) {
+        const tripoint &p = it->first;
+        const monster &critter = it->second;
+        // Most of them stay where they are. Pets, mission targets and monsters that
+        // can't move never leave.
+        if( critter.friendly != 0 || critter.mission_id != -1 || critter.type->speed <= 0 ||
+            !one_in( 4 ) ) {
+            ++it;
+            continue;
+        }
+        const tripoint dest( p.x + rng( -1, 1 ), p.y + rng( -1, 1 ), p.z );
+        const bool in_bubble = dest.x >= bubble_min.x && dest.x < bubble_min.x + bubble_size &&
+                               dest.y >= bubble_min.y && dest.y < bubble_min.y + bubble_size;
+        if( dest == p || in_bubble || dest.x < 0 || dest.y < 0 ||
+            dest.x >= OMAPX * 2 || dest.y >= OMAPY * 2 ) {
+            ++it;
+            continue;
+        }
+        moved.emplace_back( dest, it->second );
+        it = monster_map.erase( it );
+    }
+    monster_map.insert( moved.begin(), moved.end() );
+}
+
 /**
 * @param sig_power - power of signal or max distantion for reaction of zombies
 */
 void overmap::signal_hordes( const tripoint &p, const int sig_power)
 {
-    for( auto &elem : zg ) {
-        mongroup &mg = elem.second;
+    zg.update_all( [&p, sig_power]( mongroup &mg ) {
         if( !mg.horde ) {
-            continue;
+            return;
         }
             const int dist = rl_dist( p, mg.pos );
             if( sig_power < dist ) {
-                continue;
+                return;
             }
             // TODO: base this in monster attributes, foremost GOODHEARING.
             const int d_inter = ( sig_power + 1 - dist ) * SEEX;
@@ -2963,7 +3228,7 @@ void overmap::signal_hordes( const tripoint &p, const int sig_power)
                     add_msg( m_debug, "horde set interest %d", d_inter);
                 }
             }
-    }
+    } );
 }
 
 void grow_forest_oter_id(oter_id &oid, bool swampy)
@@ -3022,7 +3287,7 @@ void overmap::place_forest()
             int swamp_chance = 0;
             for (int k = -2; k <= 2; k++) {
                 for (int l = -2; l <= 2; l++) {
-                    if (ter(x + k, y + l, 0) == "forest_water" ||
+                    if (get_ter(x + k, y + l, 0) == "forest_water" ||
                         check_ot_type("river", x + k, y + l, 0)) {
                         swamp_chance += settings.swamp_river_influence;
                     }
@@ -3030,10 +3295,10 @@ void overmap::place_forest()
             }
             bool swampy = false;
             if (swamps > 0 && swamp_chance > 0 && !one_in(swamp_chance) &&
-                (ter(x, y, 0) == "forest" || ter(x, y, 0) == "forest_thick" ||
-                 ter(x, y, 0) == "field" || one_in( settings.swamp_spread_chance ))) {
+                (get_ter(x, y, 0) == "forest" || get_ter(x, y, 0) == "forest_thick" ||
+                 get_ter(x, y, 0) == "field" || one_in( settings.swamp_spread_chance ))) {
                 // ...and make a swamp.
-                ter(x, y, 0) = oter_id( "forest_water" );
+                set_ter(x, y, 0, oter_id( "forest_water" ));
                 swampy = true;
                 swamps--;
             } else if (swamp_chance == 0) {
@@ -3043,8 +3308,9 @@ void overmap::place_forest()
             // Place or embiggen forest
             for ( int mx = -1; mx < 2; mx++ ) {
                 for ( int my = -1; my < 2; my++ ) {
-                    grow_forest_oter_id( ter(x + mx, y + my, 0),
-                                         ( mx == 0 && my == 0 ? false : swampy ) );
+                    oter_id oid = get_ter( x + mx, y + my, 0 );
+                    grow_forest_oter_id( oid, ( mx == 0 && my == 0 ? false : swampy ) );
+                    set_ter( x + mx, y + my, 0, oid );
                 }
             }
             // Random walk our forest
@@ -3087,7 +3353,7 @@ void overmap::place_river(point pa, point pb)
         for (int i = -1; i <= 1; i++) {
             for (int j = -1; j <= 1; j++) {
                 if (y + i >= 0 && y + i < OMAPY && x + j >= 0 && x + j < OMAPX) {
-                    ter(x + j, y + i, 0) = oter_id( "river_center" );
+                    set_ter(x + j, y + i, 0, oter_id( "river_center" ));
                 }
             }
         }
@@ -3131,7 +3397,7 @@ void overmap::place_river(point pa, point pb)
                 if( inbounds( x + j, y + i, 0, 1 ) ||
                     // UNLESS, of course, that's where the river is headed!
                     (abs(pb.y - (y + i)) < 4 && abs(pb.x - (x + j)) < 4)) {
-                    ter(x + j, y + i, 0) = oter_id( "river_center" );
+                    set_ter(x + j, y + i, 0, oter_id( "river_center" ));
                 }
             }
         }
@@ -3196,8 +3462,8 @@ void overmap::place_cities()
         // don't draw cities across the edge of the map, they will get clipped
         int cx = rng(size - 1, OMAPX - size);
         int cy = rng(size - 1, OMAPY - size);
-        if (ter(cx, cy, 0) == settings.default_oter ) {
-            ter(cx, cy, 0) = oter_id( "road_nesw" ); // every city starts with an intersection
+        if (get_ter(cx, cy, 0) == settings.default_oter ) {
+            set_ter(cx, cy, 0, oter_id( "road_nesw" )); // every city starts with an intersection
             city tmp;
             tmp.x = cx;
             tmp.y = cy;
@@ -3217,9 +3483,9 @@ void overmap::place_cities()
 void overmap::put_building( int x, int y, om_direction::type dir, const city &town )
 {
     const point p = om_direction::displace( dir );
-    auto &tid = ter( x + p.x, y + p.y, 0 );
+    const tripoint pos( x + p.x, y + p.y, 0 );
 
-    if( tid != settings.default_oter  ) {
+    if( get_ter( pos.x, pos.y, pos.z ) != settings.default_oter  ) {
         return;
     }
 
@@ -3234,7 +3500,7 @@ void overmap::put_building( int x, int y, om_direction::type dir, const city &to
         building_tid = random_house();
     }
 
-    tid = om_direction::rotate( building_tid, om_direction::opposite( dir ) );
+    set_ter( pos.x, pos.y, pos.z, om_direction::rotate( building_tid, om_direction::opposite( dir ) ) );
 }
 
 void overmap::build_city_street( int x, int y, int cs, om_direction::type dir, const city &town )
@@ -3267,20 +3533,20 @@ void overmap::build_city_street( int x, int y, int cs, om_direction::type dir, c
 
     // Grow in the stated direction, sprouting off sub-roads and placing buildings as we go.
     while( c > 0 && inbounds( x, y, 0, 1 ) &&
-           (ter(x + bias.x, y + bias.y, 0) == settings.default_oter || c == cs) ) {
+           (get_ter(x + bias.x, y + bias.y, 0) == settings.default_oter || c == cs) ) {
         x += bias.x;
         y += bias.y;
         c--;
-        ter( x, y, 0 ) = road;
+        set_ter( x, y, 0, road );
         // Look for a crossroad or a road ahead, if we find one,
         // set current tile to be road_null and c to -1 to prevent further branching.
-        if( ter( x + bias.x, y + bias.y, 0 ) == road ||
-            ter( x + bias.x, y + bias.y, 0 ) == crossroad ||
+        if( get_ter( x + bias.x, y + bias.y, 0 ) == road ||
+            get_ter( x + bias.x, y + bias.y, 0 ) == crossroad ||
             // This looks left and right of the current motion of travel.
-            ter( x + bias.y, y + bias.x, 0 ) == road ||
-            ter( x + bias.y, y + bias.x, 0 ) == crossroad ||
-            ter( x - bias.y, y - bias.x, 0 ) == road ||
-            ter( x - bias.y, y - bias.x, 0 ) == crossroad ) {
+            get_ter( x + bias.y, y + bias.x, 0 ) == road ||
+            get_ter( x + bias.y, y + bias.x, 0 ) == crossroad ||
+            get_ter( x - bias.y, y - bias.x, 0 ) == road ||
+            get_ter( x - bias.y, y - bias.x, 0 ) == crossroad ) {
 
             c = -1;
         }
@@ -3293,8 +3559,8 @@ void overmap::build_city_street( int x, int y, int cs, om_direction::type dir, c
         }
 
         // Look to each side, and branch if the way is clear.
-        if (c < croad - 1 && c >= 2 && ( ter(x + bias.y, y + bias.x, 0) == settings.default_oter &&
-                                         ter(x - bias.y, y - bias.x, 0) == settings.default_oter ) ) {
+        if (c < croad - 1 && c >= 2 && ( get_ter(x + bias.y, y + bias.x, 0) == settings.default_oter &&
+                                         get_ter(x - bias.y, y - bias.x, 0) == settings.default_oter ) ) {
             croad = c;
             build_city_street( x, y, cs - rng( 1, 3 ), om_direction::turn_left( dir ), town );
             build_city_street( x, y, cs - rng( 1, 3 ), om_direction::turn_right( dir ), town );
@@ -3302,7 +3568,7 @@ void overmap::build_city_street( int x, int y, int cs, om_direction::type dir, c
     }
     // Now we're done growing, if there's a road ahead, add one more road segment to meet it.
     if (is_road(x + (2 * bias.x) , y + (2 * bias.y), 0)) {
-        ter( x + bias.x, y + bias.y, 0 ) = road_ns;
+        set_ter( x + bias.x, y + bias.y, 0, road_ns );
     }
 
     // If we're big, make a right turn at the edge of town.
@@ -3325,7 +3591,7 @@ bool overmap::build_lab( int x, int y, int z, int s, bool ice )
     const oter_id labt_core( labt.id().str() + "_core" );
     const oter_id labt_finale( labt.id().str() + "_finale" );
 
-    ter( x, y, z ) = labt;
+    set_ter( x, y, z, labt );
     generated_lab.push_back( point( x, y ) );
 
     // maintain a list of potential new lab maps
@@ -3339,19 +3605,19 @@ bool overmap::build_lab( int x, int y, int z, int s, bool ice )
         int dist = abs( x - cx ) + abs( y - cy );
         if( dist <= s * 2 ) { // increase radius to compensate for sparser new algorithm
             if( one_in( dist / 2 + 1 ) ) { // odds diminish farther away from the stairs
-                ter( cx, cy, z ) = labt;
+                set_ter( cx, cy, z, labt );
                 generated_lab.push_back( *cand );
                 // add new candidates, don't backtrack
-                if( ter( cx - 1, cy, z ) != labt && abs( x - cx + 1 ) + abs( y - cy ) > dist ) {
+                if( get_ter( cx - 1, cy, z ) != labt && abs( x - cx + 1 ) + abs( y - cy ) > dist ) {
                     candidates.insert( point( cx - 1, cy ) );
                 }
-                if( ter( cx + 1, cy, z ) != labt && abs( x - cx - 1 ) + abs( y - cy ) > dist ) {
+                if( get_ter( cx + 1, cy, z ) != labt && abs( x - cx - 1 ) + abs( y - cy ) > dist ) {
                     candidates.insert( point( cx + 1, cy ) );
                 }
-                if( ter( cx, cy - 1, z ) != labt && abs( x - cx ) + abs( y - cy + 1 ) > dist ) {
+                if( get_ter( cx, cy - 1, z ) != labt && abs( x - cx ) + abs( y - cy + 1 ) > dist ) {
                     candidates.insert( point( cx, cy - 1 ) );
                 }
-                if( ter( cx, cy + 1, z ) != labt && abs( x - cx ) + abs( y - cy - 1 ) > dist ) {
+                if( get_ter( cx, cy + 1, z ) != labt && abs( x - cx ) + abs( y - cy - 1 ) > dist ) {
                     candidates.insert( point( cx, cy + 1 ) );
                 }
             }
@@ -3361,16 +3627,16 @@ bool overmap::build_lab( int x, int y, int z, int s, bool ice )
 
     bool generate_stairs = true;
     for( auto &elem : generated_lab ) {
-        if( ter( elem.x, elem.y, z + 1 ) == labt_stairs ) {
+        if( get_ter( elem.x, elem.y, z + 1 ) == labt_stairs ) {
             generate_stairs = false;
         }
     }
     if( generate_stairs && !generated_lab.empty() ) {
         const point p = random_entry( generated_lab );
-        ter( p.x, p.y, z + 1 ) = labt_stairs;
+        set_ter( p.x, p.y, z + 1, labt_stairs );
     }
 
-    ter( x, y, z ) = labt_core;
+    set_ter( x, y, z, labt_core );
     int numstairs = 0;
     if( s > 0 ) { // Build stairs going down
         while( !one_in( 6 ) ) {
@@ -3380,9 +3646,9 @@ bool overmap::build_lab( int x, int y, int z, int s, bool ice )
                 stairx = rng( x - s, x + s );
                 stairy = rng( y - s, y + s );
                 tries++;
-            } while( ter( stairx, stairy, z ) != labt && tries < 15 );
+            } while( get_ter( stairx, stairy, z ) != labt && tries < 15 );
             if( tries < 15 ) {
-                ter( stairx, stairy, z ) = labt_stairs;
+                set_ter( stairx, stairy, z, labt_stairs );
                 numstairs++;
             }
         }
@@ -3394,9 +3660,9 @@ bool overmap::build_lab( int x, int y, int z, int s, bool ice )
             finalex = rng( x - s, x + s );
             finaley = rng( y - s, y + s );
             tries++;
-        } while( tries < 15 && ter( finalex, finaley, z ) != labt
-                  && ter( finalex, finaley, z ) != labt_core );
-        ter( finalex, finaley, z ) = labt_finale;
+        } while( tries < 15 && get_ter( finalex, finaley, z ) != labt
+                  && get_ter( finalex, finaley, z ) != labt_core );
+        set_ter( finalex, finaley, z, labt_finale );
     }
 
     return numstairs > 0;
@@ -3417,7 +3683,7 @@ void overmap::build_anthill(int x, int y, int z, int s)
         }
     }
     const point target = random_entry( queenpoints );
-    ter(target.x, target.y, z) = oter_id( "ants_queen" );
+    set_ter(target.x, target.y, z, oter_id( "ants_queen" ));
 }
 
 void overmap::build_tunnel( int x, int y, int z, int s, om_direction::type dir )
@@ -3426,7 +3692,7 @@ void overmap::build_tunnel( int x, int y, int z, int s, om_direction::type dir )
         return;
     }
     if (!check_ot_type("ants", x, y, z)) {
-        ter(x, y, z) = oter_id( "ants_ns" );
+        set_ter(x, y, z, oter_id( "ants_ns" ));
     }
 
     std::vector<om_direction::type> valid;
@@ -3448,9 +3714,9 @@ void overmap::build_tunnel( int x, int y, int z, int s, om_direction::type dir )
         if( p.x != next.x || p.y != next.y ) {
             if (one_in(s * 2)) {
                 if (one_in(2)) {
-                    ter( p.x, p.y, z ) = ants_food;
+                    set_ter( p.x, p.y, z, ants_food );
                 } else {
-                    ter( p.x, p.y, z ) = ants_larvae;
+                    set_ter( p.x, p.y, z, ants_larvae );
                 }
             } else if (one_in(5)) {
                 build_tunnel( p.x, p.y, z, s - rng( 0, 3 ), r );
@@ -3472,10 +3738,10 @@ bool overmap::build_slimepit( int x, int y, int z, int s )
         if( one_in( 2 * dist ) ) {
             chip_rock( p.x, p.y, p.z );
             if( one_in( 8 ) && z > -OVERMAP_DEPTH ) {
-                ter( p.x, p.y, p.z ) = slimepit_down;
+                set_ter( p.x, p.y, p.z, slimepit_down );
                 requires_sub = true;
             } else {
-                ter( p.x, p.y, p.z ) = slimepit;
+                set_ter( p.x, p.y, p.z, slimepit );
             }
         }
     }
@@ -3495,18 +3761,18 @@ void overmap::build_mine(int x, int y, int z, int s)
         s = 2;
     }
     while (built < s) {
-        ter(x, y, z) = mine;
+        set_ter(x, y, z, mine);
         std::vector<point> next;
         for (int i = -1; i <= 1; i += 2) {
-            if( ter( x, y + i, z ) == empty_rock ) {
+            if( get_ter( x, y + i, z ) == empty_rock ) {
                 next.push_back( point(x, y + i) );
             }
-            if( ter( x + i, y, z ) == empty_rock ) {
+            if( get_ter( x + i, y, z ) == empty_rock ) {
                 next.push_back( point(x + i, y) );
             }
         }
         if (next.empty()) { // Dead end!  Go down!
-            ter(x, y, z) = mine_finale_or_down;
+            set_ter(x, y, z, mine_finale_or_down);
             return;
         }
         const point p = random_entry( next );
@@ -3514,7 +3780,7 @@ void overmap::build_mine(int x, int y, int z, int s)
         y = p.y;
         built++;
     }
-    ter(x, y, z) = mine_finale_or_down;
+    set_ter(x, y, z, mine_finale_or_down);
 }
 
 void overmap::place_rifts(int const z)
@@ -3542,9 +3808,9 @@ void overmap::place_rifts(int const z)
             }
             for (size_t i = 0; i < riftline.size(); i++) {
                 if (i == riftline.size() / 2 && !one_in(3)) {
-                    ter(riftline[i].x, riftline[i].y, z) = hellmouth;
+                    set_ter(riftline[i].x, riftline[i].y, z, hellmouth);
                 } else {
-                    ter(riftline[i].x, riftline[i].y, z) = rift;
+                    set_ter(riftline[i].x, riftline[i].y, z, rift);
                 }
             }
         }
@@ -3559,12 +3825,12 @@ void overmap::make_hiway( int x1, int y1, int x2, int y2, int z, const std::stri
 
     const auto estimate = [ this, disp, &base, &dest ]( const pf::node &prev, const pf::node &cur ) {
         // Reject nodes that don't allow roads to cross them (e.g. buildings)
-        if( !road_allowed( ter( cur.x, cur.y, dest.z ) ) ) {
+        if( !road_allowed( get_ter( cur.x, cur.y, dest.z ) ) ) {
             return -1;
         }
         // Reject nodes that make corners on the river
-        if( prev.dir != cur.dir && ( is_river( ter( prev.x, prev.y, dest.z ) ) ||
-                                     is_river( ter( cur.x, cur.y, dest.z ) ) ) ) {
+        if( prev.dir != cur.dir && ( is_river( get_ter( prev.x, prev.y, dest.z ) ) ||
+                                     is_river( get_ter( cur.x, cur.y, dest.z ) ) ) ) {
             return -1;
         }
 
@@ -3572,7 +3838,7 @@ void overmap::make_hiway( int x1, int y1, int x2, int y2, int z, const std::stri
         // Prefer existing roads.
         res += check_ot_type( base, cur.x, cur.y, dest.z ) ? 0 : 3;
         // Prefer flat land over bridges
-        res += !is_river( ter( cur.x, cur.y, dest.z ) ) ? 0 : 2;
+        res += !is_river( get_ter( cur.x, cur.y, dest.z ) ) ? 0 : 2;
         // Try not to turn too much
         //res += (mn.d == d) ? 0 : 1;
         return res;
@@ -3583,12 +3849,10 @@ void overmap::make_hiway( int x1, int y1, int x2, int y2, int z, const std::stri
     const oter_id base_nesw( base + "_nesw" );
 
     for( const auto &node : pf::find_path( source, dest, OMAPX, OMAPY, estimate ) ) {
-        auto &id = ter( node.x, node.y, z );
-
-        if( is_river( id ) ) {
-            id = node.dir == 1 || node.dir == 3 ? bridge_ns : bridge_ew;
+        if( is_river( get_ter( node.x, node.y, z ) ) ) {
+            set_ter( node.x, node.y, z, node.dir == 1 || node.dir == 3 ? bridge_ns : bridge_ew );
         } else {
-            id = base_nesw;
+            set_ter( node.x, node.y, z, base_nesw );
         }
     }
 }
@@ -3630,7 +3894,7 @@ void overmap::polish(const int z, const std::string &terrain_type)
                     check_ot_type("bridge", x + 1, y, z) &&
                     check_ot_type("bridge", x, y - 1, z) &&
                     check_ot_type("bridge", x, y + 1, z)) {
-                    ter(x, y, z) = road_nesw;
+                    set_ter(x, y, z, road_nesw);
                 } else if (check_ot_type("subway", x, y, z)) {
                     good_road("subway", x, y, z);
                 } else if (check_ot_type("sewer", x, y, z)) {
@@ -3647,13 +3911,13 @@ void overmap::polish(const int z, const std::string &terrain_type)
                     // So, fix it by making that square normal road;
                     // also taking other road pieces that may be next
                     // to it into account. A bit of a kludge but it works.
-                } else if (ter(x, y, z) == "bridge_ns" &&
-                           (!is_river(ter(x - 1, y, z)) ||
-                            !is_river(ter(x + 1, y, z)))) {
+                } else if (get_ter(x, y, z) == "bridge_ns" &&
+                           (!is_river(get_ter(x - 1, y, z)) ||
+                            !is_river(get_ter(x + 1, y, z)))) {
                     good_road("road", x, y, z);
-                } else if (ter(x, y, z) == "bridge_ew" &&
-                           (!is_river(ter(x, y - 1, z)) ||
-                            !is_river(ter(x, y + 1, z)))) {
+                } else if (get_ter(x, y, z) == "bridge_ew" &&
+                           (!is_river(get_ter(x, y - 1, z)) ||
+                            !is_river(get_ter(x, y + 1, z)))) {
                     good_road("road", x, y, z);
                 } else if (check_ot_type("road", x, y, z)) {
                     good_road("road", x, y, z);
@@ -3671,22 +3935,22 @@ void overmap::polish(const int z, const std::string &terrain_type)
     for (int y = 0; y < OMAPY - 1; y++) {
         for (int x = 0; x < OMAPX - 1; x++) {
             if (check_ot_type(terrain_type, x, y, z)) {
-                if (ter(x, y, z) == "road_nes"
-                    && ter(x + 1, y, z) == "road_nsw"
-                    && ter(x, y + 1, z) == "road_nes"
-                    && ter(x + 1, y + 1, z) == "road_nsw") {
-                    ter(x, y, z) = oter_id( "hiway_ns" );
-                    ter(x + 1, y, z) = oter_id( "hiway_ns" );
-                    ter(x, y + 1, z) = oter_id( "hiway_ns" );
-                    ter(x + 1, y + 1, z) = oter_id( "hiway_ns" );
-                } else if (ter(x, y, z) == "road_esw"
-                           && ter(x + 1, y, z) == "road_esw"
-                           && ter(x, y + 1, z) == "road_new"
-                           && ter(x + 1, y + 1, z) == "road_new" ) {
-                    ter(x, y, z) = oter_id( "hiway_ew" );
-                    ter(x + 1, y, z) = oter_id( "hiway_ew" );
-                    ter(x, y + 1, z) = oter_id( "hiway_ew" );
-                    ter(x + 1, y + 1, z) = oter_id( "hiway_ew" );
+                if (get_ter(x, y, z) == "road_nes"
+                    && get_ter(x + 1, y, z) == "road_nsw"
+                    && get_ter(x, y + 1, z) == "road_nes"
+                    && get_ter(x + 1, y + 1, z) == "road_nsw") {
+                    set_ter(x, y, z, oter_id( "hiway_ns" ));
+                    set_ter(x + 1, y, z, oter_id( "hiway_ns" ));
+                    set_ter(x, y + 1, z, oter_id( "hiway_ns" ));
+                    set_ter(x + 1, y + 1, z, oter_id( "hiway_ns" ));
+                } else if (get_ter(x, y, z) == "road_esw"
+                           && get_ter(x + 1, y, z) == "road_esw"
+                           && get_ter(x, y + 1, z) == "road_new"
+                           && get_ter(x + 1, y + 1, z) == "road_new" ) {
+                    set_ter(x, y, z, oter_id( "hiway_ew" ));
+                    set_ter(x + 1, y, z, oter_id( "hiway_ew" ));
+                    set_ter(x, y + 1, z, oter_id( "hiway_ew" ));
+                    set_ter(x + 1, y + 1, z, oter_id( "hiway_ew" ));
                 }
             }
         }
@@ -3699,20 +3963,20 @@ void overmap::chip_rock(int x, int y, int z)
     const oter_id rock( "rock" );
     const oter_id empty_rock( "empty_rock" );
 
-    if( ter( x - 1, y, z ) == empty_rock ) {
-        ter( x - 1, y, z ) = rock;
+    if( get_ter( x - 1, y, z ) == empty_rock ) {
+        set_ter( x - 1, y, z, rock );
     }
 
-    if( ter( x + 1, y, z ) == empty_rock ) {
-        ter( x + 1, y, z ) = rock;
+    if( get_ter( x + 1, y, z ) == empty_rock ) {
+        set_ter( x + 1, y, z, rock );
     }
 
-    if( ter( x, y - 1, z ) == empty_rock ) {
-        ter( x, y - 1, z ) = rock;
+    if( get_ter( x, y - 1, z ) == empty_rock ) {
+        set_ter( x, y - 1, z, rock );
     }
 
-    if( ter( x, y + 1, z ) == empty_rock ) {
-        ter( x, y + 1, z ) = rock;
+    if( get_ter( x, y + 1, z ) == empty_rock ) {
+        set_ter( x, y + 1, z, rock );
     }
 }
 
@@ -3724,7 +3988,7 @@ bool overmap::check_ot_type(const std::string &otype, int x, int y, int z) const
 
 bool overmap::check_ot_type_road(const std::string &otype, int x, int y, int z)
 {
-    const oter_id oter = ter(x, y, z);
+    const oter_id oter = get_ter(x, y, z);
     if(otype == "road" || otype == "bridge" || otype == "hiway") {
         if(is_ot_type("road", oter) || is_ot_type ("bridge", oter) || is_ot_type("hiway", oter)) {
             return true;
@@ -3746,8 +4010,8 @@ bool overmap::is_road(int x, int y, int z)
             }
         }
     }
-    return ter(x, y, z)->has_flag( road_tile );
-    //oter_t(ter(x, y, z)).is_road;
+    return get_ter(x, y, z)->has_flag( road_tile );
+    //oter_t(get_ter(x, y, z)).is_road;
 }
 
 void overmap::good_road(const std::string &base, int x, int y, int z)
@@ -3756,32 +4020,32 @@ void overmap::good_road(const std::string &base, int x, int y, int z)
         if (check_ot_type_road(base, x + 1, y, z)) {
             if (check_ot_type_road(base, x, y + 1, z)) {
                 if (check_ot_type_road(base, x - 1, y, z)) {
-                    ter(x, y, z) = oter_id( base + "_nesw" );
+                    set_ter(x, y, z, oter_id( base + "_nesw" ));
                 } else {
-                    ter(x, y, z) = oter_id( base + "_nes" );
+                    set_ter(x, y, z, oter_id( base + "_nes" ));
                 }
             } else {
                 if (check_ot_type_road(base, x - 1, y, z)) {
-                    ter(x, y, z) = oter_id( base + "_new" );
+                    set_ter(x, y, z, oter_id( base + "_new" ));
                 } else {
-                    ter(x, y, z) = oter_id( base + "_ne" );
+                    set_ter(x, y, z, oter_id( base + "_ne" ));
                 }
             }
         } else {
             if (check_ot_type_road(base, x, y + 1, z)) {
                 if (check_ot_type(base, x - 1, y, z)) {
-                    ter(x, y, z) = oter_id( base + "_nsw" );
+                    set_ter(x, y, z, oter_id( base + "_nsw" ));
                 } else {
-                    ter(x, y, z) = oter_id( base + "_ns" );
+                    set_ter(x, y, z, oter_id( base + "_ns" ));
                 }
             } else {
                 if (check_ot_type_road(base, x - 1, y, z)) {
-                    ter(x, y, z) = oter_id( base + "_wn" );
+                    set_ter(x, y, z, oter_id( base + "_wn" ));
                 } else {
                     if(base == "road" && (y != OMAPY - 1)) {
-                        ter(x, y, z) = oter_id( base + "_end_south" );
+                        set_ter(x, y, z, oter_id( base + "_end_south" ));
                     } else {
-                        ter(x, y, z) = oter_id( base + "_ns" );
+                        set_ter(x, y, z, oter_id( base + "_ns" ));
                     }
                 }
             }
@@ -3790,138 +4054,138 @@ void overmap::good_road(const std::string &base, int x, int y, int z)
         if (check_ot_type_road(base, x + 1, y, z)) {
             if (check_ot_type_road(base, x, y + 1, z)) {
                 if (check_ot_type_road(base, x - 1, y, z)) {
-                    ter(x, y, z) = oter_id( base + "_esw" );
+                    set_ter(x, y, z, oter_id( base + "_esw" ));
                 } else {
-                    ter(x, y, z) = oter_id( base + "_es" );
+                    set_ter(x, y, z, oter_id( base + "_es" ));
                 }
             } else {
                 if( check_ot_type_road(base, x - 1, y, z)) {
-                    ter(x, y, z) = oter_id( base + "_ew" );
+                    set_ter(x, y, z, oter_id( base + "_ew" ));
                 } else {
                     if(base == "road" && (x != 0)) {
-                        ter(x, y, z) = oter_id( base + "_end_west" );
+                        set_ter(x, y, z, oter_id( base + "_end_west" ));
                     } else {
-                        ter(x, y, z) = oter_id( base + "_ew" );
+                        set_ter(x, y, z, oter_id( base + "_ew" ));
                     }
                 }
             }
         } else {
             if (check_ot_type_road(base, x, y + 1, z)) {
                 if (check_ot_type_road(base, x - 1, y, z)) {
-                    ter(x, y, z) = oter_id( base + "_sw" );
+                    set_ter(x, y, z, oter_id( base + "_sw" ));
                 } else {
                     if(base == "road" && (y != 0)) {
-                        ter(x, y, z) = oter_id( base + "_end_north" );
+                        set_ter(x, y, z, oter_id( base + "_end_north" ));
                     } else {
-                        ter(x, y, z) = oter_id( base + "_ns" );
+                        set_ter(x, y, z, oter_id( base + "_ns" ));
                     }
                 }
             } else {
                 if (check_ot_type_road(base, x - 1, y, z)) {
                     if(base == "road" && (x != OMAPX-1)) {
-                        ter(x, y, z) = oter_id( base + "_end_east" );
+                        set_ter(x, y, z, oter_id( base + "_end_east" ));
                     } else {
-                        ter(x, y, z) = oter_id( base + "_ew" );
+                        set_ter(x, y, z, oter_id( base + "_ew" ));
                     }
                 } else {
                     // No adjoining roads/etc.
                     // Happens occasionally, esp. with sewers.
-                    ter(x, y, z) = oter_id( base + "_nesw" );
+                    set_ter(x, y, z, oter_id( base + "_nesw" ));
                 }
             }
         }
     }
-    if (ter(x, y, z) == "road_nesw" && one_in(4)) {
-        ter(x, y, z) = oter_id( "road_nesw_manhole" );
+    if (get_ter(x, y, z) == "road_nesw" && one_in(4)) {
+        set_ter(x, y, z, oter_id( "road_nesw_manhole" ));
     }
 }
 
 void overmap::good_river(int x, int y, int z)
 {
     if((x == 0) || (x == OMAPX-1)) {
-        if(!is_river(ter(x, y - 1, z))) {
-            ter(x, y, z) = oter_id( "river_north" );
-        } else if(!is_river(ter(x, y + 1, z))) {
-            ter(x, y, z) = oter_id( "river_south" );
+        if(!is_river(get_ter(x, y - 1, z))) {
+            set_ter(x, y, z, oter_id( "river_north" ));
+        } else if(!is_river(get_ter(x, y + 1, z))) {
+            set_ter(x, y, z, oter_id( "river_south" ));
         } else {
-            ter(x, y, z) = oter_id( "river_center" );
+            set_ter(x, y, z, oter_id( "river_center" ));
         }
         return;
     }
     if((y == 0) || (y == OMAPY-1)) {
-        if(!is_river(ter(x - 1, y, z))) {
-            ter(x, y, z) = oter_id( "river_west" );
-        } else if(!is_river(ter(x + 1, y, z))) {
-            ter(x, y, z) = oter_id( "river_east" );
+        if(!is_river(get_ter(x - 1, y, z))) {
+            set_ter(x, y, z, oter_id( "river_west" ));
+        } else if(!is_river(get_ter(x + 1, y, z))) {
+            set_ter(x, y, z, oter_id( "river_east" ));
         } else {
-            ter(x, y, z) = oter_id( "river_center" );
+            set_ter(x, y, z, oter_id( "river_center" ));
         }
         return;
     }
-    if (is_river(ter(x - 1, y, z))) {
-        if (is_river(ter(x, y - 1, z))) {
-            if (is_river(ter(x, y + 1, z))) {
-                if (is_river(ter(x + 1, y, z))) {
+    if (is_river(get_ter(x - 1, y, z))) {
+        if (is_river(get_ter(x, y - 1, z))) {
+            if (is_river(get_ter(x, y + 1, z))) {
+                if (is_river(get_ter(x + 1, y, z))) {
                     // River on N, S, E, W;
                     // but we might need to take a "bite" out of the corner
-                    if (!is_river(ter(x - 1, y - 1, z))) {
-                        ter(x, y, z) = oter_id( "river_c_not_nw" );
-                    } else if (!is_river(ter(x + 1, y - 1, z))) {
-                        ter(x, y, z) = oter_id( "river_c_not_ne");
-                    } else if (!is_river(ter(x - 1, y + 1, z))) {
-                        ter(x, y, z) = oter_id( "river_c_not_sw" );
-                    } else if (!is_river(ter(x + 1, y + 1, z))) {
-                        ter(x, y, z) = oter_id( "river_c_not_se" );
+                    if (!is_river(get_ter(x - 1, y - 1, z))) {
+                        set_ter(x, y, z, oter_id( "river_c_not_nw" ));
+                    } else if (!is_river(get_ter(x + 1, y - 1, z))) {
+                        set_ter(x, y, z, oter_id( "river_c_not_ne"));
+                    } else if (!is_river(get_ter(x - 1, y + 1, z))) {
+                        set_ter(x, y, z, oter_id( "river_c_not_sw" ));
+                    } else if (!is_river(get_ter(x + 1, y + 1, z))) {
+                        set_ter(x, y, z, oter_id( "river_c_not_se" ));
                     } else {
-                        ter(x, y, z) = oter_id( "river_center" );
+                        set_ter(x, y, z, oter_id( "river_center" ));
                     }
                 } else {
-                    ter(x, y, z) = oter_id( "river_east" );
+                    set_ter(x, y, z, oter_id( "river_east" ));
                 }
             } else {
-                if (is_river(ter(x + 1, y, z))) {
-                    ter(x, y, z) = oter_id( "river_south" );
+                if (is_river(get_ter(x + 1, y, z))) {
+                    set_ter(x, y, z, oter_id( "river_south" ));
                 } else {
-                    ter(x, y, z) = oter_id( "river_se" );
+                    set_ter(x, y, z, oter_id( "river_se" ));
                 }
             }
         } else {
-            if (is_river(ter(x, y + 1, z))) {
-                if (is_river(ter(x + 1, y, z))) {
-                    ter(x, y, z) = oter_id( "river_north" );
+            if (is_river(get_ter(x, y + 1, z))) {
+                if (is_river(get_ter(x + 1, y, z))) {
+                    set_ter(x, y, z, oter_id( "river_north" ));
                 } else {
-                    ter(x, y, z) = oter_id( "river_ne" );
+                    set_ter(x, y, z, oter_id( "river_ne" ));
                 }
             } else {
-                if (is_river(ter(x + 1, y, z))) { // Means it's swampy
-                    ter(x, y, z) = oter_id( "forest_water" );
+                if (is_river(get_ter(x + 1, y, z))) { // Means it's swampy
+                    set_ter(x, y, z, oter_id( "forest_water" ));
                 }
             }
         }
     } else {
-        if (is_river(ter(x, y - 1, z))) {
-            if (is_river(ter(x, y + 1, z))) {
-                if (is_river(ter(x + 1, y, z))) {
-                    ter(x, y, z) = oter_id( "river_west" );
+        if (is_river(get_ter(x, y - 1, z))) {
+            if (is_river(get_ter(x, y + 1, z))) {
+                if (is_river(get_ter(x + 1, y, z))) {
+                    set_ter(x, y, z, oter_id( "river_west" ));
                 } else { // Should never happen
-                    ter(x, y, z) = oter_id( "forest_water" );
+                    set_ter(x, y, z, oter_id( "forest_water" ));
                 }
             } else {
-                if (is_river(ter(x + 1, y, z))) {
-                    ter(x, y, z) = oter_id( "river_sw" );
+                if (is_river(get_ter(x + 1, y, z))) {
+                    set_ter(x, y, z, oter_id( "river_sw" ));
                 } else { // Should never happen
-                    ter(x, y, z) = oter_id( "forest_water" );
+                    set_ter(x, y, z, oter_id( "forest_water" ));
                 }
             }
         } else {
-            if (is_river(ter(x, y + 1, z))) {
-                if (is_river(ter(x + 1, y, z))) {
-                    ter(x, y, z) = oter_id( "river_nw" );
+            if (is_river(get_ter(x, y + 1, z))) {
+                if (is_river(get_ter(x + 1, y, z))) {
+                    set_ter(x, y, z, oter_id( "river_nw" ));
                 } else { // Should never happen
-                    ter(x, y, z) = oter_id( "forest_water" );
+                    set_ter(x, y, z, oter_id( "forest_water" ));
                 }
             } else { // Should never happen
-                ter(x, y, z) = oter_id( "forest_water" );
+                set_ter(x, y, z, oter_id( "forest_water" ));
             }
         }
     }
@@ -4092,13 +4356,13 @@ void overmap::place_special( const overmap_special &special, const tripoint &p,
         const oter_id tid = om_direction::rotate( elem.terrain.id(), dir );
         const tripoint location = p + om_direction::rotate( elem.p, dir );
 
-        ter( location.x, location.y, location.z ) = tid;
+        set_ter( location.x, location.y, location.z, tid );
 
         if( blob ) {
             for (int x = -2; x <= 2; x++) {
                 for (int y = -2; y <= 2; y++) {
                     if (one_in(1 + abs(x) + abs(y))) {
-                        ter( location.x + x, location.y + y, location.z ) = tid;
+                        set_ter( location.x + x, location.y + y, location.z, tid );
                     }
                 }
             }
@@ -4276,7 +4540,7 @@ void overmap::place_mongroups()
                 int swamp_count = 0;
                 for (int sx = x - 3; sx <= x + 3; sx++) {
                     for (int sy = y - 3; sy <= y + 3; sy++) {
-                        if (ter(sx, sy, 0) == "forest_water") {
+                        if (get_ter(sx, sy, 0) == "forest_water") {
                             swamp_count += 2;
                         }
                     }
@@ -4295,7 +4559,7 @@ void overmap::place_mongroups()
                 int river_count = 0;
                 for (int sx = x - 3; sx <= x + 3; sx++) {
                     for (int sy = y - 3; sy <= y + 3; sy++) {
-                        if (is_river(ter(sx, sy, 0))) {
+                        if (is_river(get_ter(sx, sy, 0))) {
                             river_count++;
                         }
                     }
@@ -4327,7 +4591,7 @@ void overmap::place_radios()
     std::string message;
     for (int i = 0; i < OMAPX; i++) {
         for (int j = 0; j < OMAPY; j++) {
-            if (ter(i, j, 0) == "radio_tower") {
+            if (get_ter(i, j, 0) == "radio_tower") {
                 int choice = rng(0, 2);
                 switch(choice) {
                 case 0:
@@ -4344,12 +4608,12 @@ void overmap::place_radios()
                                                  WEATHER_RADIO));
                     break;
                 }
-            } else if (ter(i, j, 0) == "lmoe") {
+            } else if (get_ter(i, j, 0) == "lmoe") {
                 message = string_format(_("This is automated emergency shelter beacon %d%d.\
   Supplies, amenities and shelter are stocked."), i, j);
                 radios.push_back(radio_tower(i * 2, j * 2, rng(RADIO_MIN_STRENGTH, RADIO_MAX_STRENGTH) / 2,
                                              message));
-            } else if (ter(i, j, 0) == "fema_entrance") {
+            } else if (get_ter(i, j, 0) == "fema_entrance") {
                 message = string_format(_("This is FEMA camp %d%d.\
   Supplies are limited, please bring supplemental food, water, and bedding.\
   This is FEMA camp %d%d.  A designated long-term emergency shelter."), i, j, i, j);
@@ -4359,14 +4623,46 @@ void overmap::place_radios()
     }
 }
 
+/**
+ * Wraps @p reader, so it also stores the hash of the file content in @p hash (see
+ * @ref serialize_changed). Saving the overmap unchanged then doesn't rewrite the file.
+ */
+static std::function<void( std::istream & )> hashed_reader( size_t &hash,
+        const std::function<void( std::istream & )> &reader )
+{
+    return [&hash, reader]( std::istream & fin ) {
+        const std::string data( ( std::istreambuf_iterator<char>( fin ) ),
+                                std::istreambuf_iterator<char>() );
+        hash = std::hash<std::string>()( data );
+        std::istringstream stream( data );
+        reader( stream );
+    };
+}
+
 void overmap::open()
 {
     std::string const plrfilename = overmapbuffer::player_filename(loc.x, loc.y);
     std::string const terfilename = overmapbuffer::terrain_filename(loc.x, loc.y);
 
     using namespace std::placeholders;
-    if( read_from_file_optional( terfilename, std::bind( &overmap::unserialize, this, _1 ) ) ) {
-        read_from_file_optional( plrfilename, std::bind( &overmap::unserialize_view, this, _1 ) );
+    if( overmap_buffer.read_file_optional( terfilename, hashed_reader( main_hash,
+                                           std::bind( &overmap::unserialize, this, _1 ) ) ) ) {
+        // Saves from before the chunked layout have the layers in the main file instead.
+        // They remain marked as dirty, so they are written as chunks on the next save.
+        for( int chunk = 0; chunk < layer_chunks; ++chunk ) {
+            overmap_buffer.read_file_optional( overmapbuffer::terrain_chunk_filename( loc.x, loc.y, chunk ),
+                                               hashed_reader( terrain_chunk_hash[chunk],
+                                                       std::bind( &overmap::unserialize_layer_chunk, this, _1, chunk ) ) );
+        }
+        bool has_view_chunks = false;
+        for( int chunk = 0; chunk < layer_chunks; ++chunk ) {
+            has_view_chunks |= overmap_buffer.read_file_optional( overmapbuffer::player_chunk_filename(
+                                   loc.x, loc.y, chunk ), hashed_reader( view_chunk_hash[chunk],
+                                           std::bind( &overmap::unserialize_view_chunk, this, _1, chunk ) ) );
+        }
+        if( !has_view_chunks ) {
+            overmap_buffer.read_file_optional( plrfilename, std::bind( &overmap::unserialize_view, this, _1 ) );
+        }
     } else { // No map exists!  Prepare neighbors, and generate one.
         std::vector<const overmap*> pointers;
         // Fetch south and north
@@ -4382,19 +4678,77 @@ void overmap::open()
     }
 }
 
+/**
+ * Serializes into a string and returns whether it differs from the data described by @p hash.
+ * @param new_hash Receives the hash of the new data. The caller stores it once the data
+ * has been written, so a failed write is retried on the next save.
+ */
+static bool serialize_changed( std::string &data, const size_t hash, size_t &new_hash,
+                               const std::function<void( std::ostream & )> &writer )
+{
+    std::ostringstream buffer;
+    writer( buffer );
+    data = buffer.str();
+    new_hash = std::hash<std::string>()( data );
+    return new_hash != hash;
+}
+
 // Note: this may throw io errors from std::ofstream
 void overmap::save() const
 {
-    std::string const plrfilename = overmapbuffer::player_filename(loc.x, loc.y);
-    std::string const terfilename = overmapbuffer::terrain_filename(loc.x, loc.y);
+    using namespace std::placeholders;
+    std::string data;
+    size_t new_hash = 0;
+    // The chunks are written before the main file, which is how the game detects whether
+    // the overmap exists at all.
+    for( int chunk = 0; chunk < layer_chunks; ++chunk ) {
+        const auto first = terrain_dirty.begin() + chunk_first_layer( chunk );
+        const auto last = terrain_dirty.begin() + chunk_first_layer( chunk + 1 );
+        if( std::find( first, last, true ) == last ) {
+            continue;
+        }
+        if( serialize_changed( data, terrain_chunk_hash[chunk], new_hash,
+                               std::bind( &overmap::serialize_layer_chunk, this, _1, chunk ) ) ) {
+            ofstream_wrapper_exclusive fout( overmapbuffer::terrain_chunk_filename( loc.x, loc.y, chunk ) );
+            fout.stream() << data;
+            fout.close();
+            terrain_chunk_hash[chunk] = new_hash;
+        }
+        std::fill( first, last, false );
+    }
 
-    ofstream_wrapper fout_player( plrfilename );
-    serialize_view( fout_player );
-    fout_player.close();
+    bool wrote_view = false;
+    for( int chunk = 0; chunk < layer_chunks; ++chunk ) {
+        const auto first = view_dirty.begin() + chunk_first_layer( chunk );
+        const auto last = view_dirty.begin() + chunk_first_layer( chunk + 1 );
+        if( std::find( first, last, true ) == last ) {
+            continue;
+        }
+        if( serialize_changed( data, view_chunk_hash[chunk], new_hash,
+                               std::bind( &overmap::serialize_view_chunk, this, _1, chunk ) ) ) {
+            ofstream_wrapper fout( overmapbuffer::player_chunk_filename( loc.x, loc.y, chunk ) );
+            fout.stream() << data;
+            fout.close();
+            view_chunk_hash[chunk] = new_hash;
+            wrote_view = true;
+        }
+        std::fill( first, last, false );
+    }
+    if( wrote_view ) {
+        // The single file of the old layout would otherwise be loaded if a chunk is missing.
+        const std::string plrfilename = overmapbuffer::player_filename( loc.x, loc.y );
+        if( file_exist( plrfilename ) ) {
+            remove_file( plrfilename );
+        }
+    }
 
-    ofstream_wrapper_exclusive fout_terrain( terfilename );
-    serialize( fout_terrain );
-    fout_terrain.close();
+    if( serialize_changed( data, main_hash, new_hash,
+                           std::bind( &overmap::serialize, this, _1, false ) ) ) {
+        ofstream_wrapper_exclusive fout_terrain( overmapbuffer::terrain_filename( loc.x, loc.y ) );
+        fout_terrain.stream() << data;
+        fout_terrain.close();
+        main_hash = new_hash;
+    }
 }
 
 
@@ -4510,7 +4864,7 @@ void overmap::add_mon_group(const mongroup &group)
     // makes the diffuse setting obsolete (as it only controls how the radius
     // is interpreted) - it's only used when adding monster groups with function.
     if( group.radius == 1 ) {
-        zg.insert(std::pair<tripoint, mongroup>( group.pos, group ) );
+        zg.insert( group );
         return;
     }
     // diffuse groups use a circular area, non-diffuse groups use a rectangular area
@@ -7,9 +7,11 @@
 #include "weighted_list.h"
 #include "game_constants.h"
 #include "monster.h"
+#include "mongroup.h"
 #include "weather_gen.h"
 
 #include <array>
+#include <bitset>
 #include <iosfwd>
 #include <list>
 #include <map>
@@ -19,6 +21,7 @@
 #include <memory>
 
 class input_context;
+class JsonIn;
 class JsonObject;
 class npc;
 class overmapbuffer;
@@ -150,9 +153,24 @@ radio_tower(int X = -1, int Y = -1, int S = -1, std::string M = "",
 
 struct map_layer {
     oter_id terrain[OMAPX][OMAPY];
-    bool visible[OMAPX][OMAPY];
-    bool explored[OMAPX][OMAPY];
+    /** One bit per tile, use @ref tile for the index. */
+    std::bitset<OMAPX * OMAPY> visible;
+    std::bitset<OMAPX * OMAPY> explored;
     std::vector<om_note> notes;
+
+    static size_t tile( const int x, const int y ) {
+        return x * OMAPY + y;
+    }
+};
+
+/**
+ * The scent on one z-level of an overmap, one value per overmap terrain tile (x major).
+ * It spreads to the adjacent tiles and fades in @ref overmap::diffuse_scents.
+ */
+struct scent_layer {
+    std::vector<float> strength = std::vector<float>( OMAPX * OMAPY, 0.0f );
+    /** Turn the scent at the tile was left, -1 if there is none. */
+    std::vector<int> turn = std::vector<int>( OMAPX * OMAPY, -1 );
 };
 
 class overmap
@@ -184,12 +202,39 @@ class overmap
      * coordinates), or empty vector if no matching terrain is found.
      */
     std::vector<point> find_terrain(const std::string &term, int zlevel);
+    /**
+     * Local overmap terrain coordinates of all terrain on z-level @p z whose type is
+     * one of @p types (see @ref find_ot_types). This uses @ref terrain_index instead
+     * of checking each position.
+     */
+    std::vector<point> find_ot_types( const std::vector<oter_id> &types, int z ) const;
 
-    oter_id& ter(const int x, const int y, const int z);
-    const oter_id get_ter(const int x, const int y, const int z) const;
-    bool&   seen(int x, int y, int z);
-    bool&   explored(int x, int y, int z);
+    const oter_id &get_ter(const int x, const int y, const int z) const;
+    /** Changes the terrain and marks the layer as changed, see @ref terrain_dirty. */
+    void set_ter( int x, int y, int z, const oter_id &id );
+    bool seen(int x, int y, int z) const;
+    void set_seen(int x, int y, int z, bool seen);
     bool is_explored(int const x, int const y, int const z) const;
+    void set_explored(int x, int y, int z, bool explored);
+
+    /**
+     * What @ref draw shows for a tile, unless something that is not cached (the player,
+     * npcs, hordes, the cursor etc.) is on it.
+     */
+    struct tile_glyph {
+        long sym = ' ';
+        nc_color color = c_black;
+        bool seen = false;
+        bool explored = false;
+        bool has_note = false;
+        bool has_vehicle = false;
+    };
+    /**
+     * The tile glyph at local overmap terrain coordinates, which must be in bounds.
+     * The glyphs are built in chunks when first needed, and dropped again by everything
+     * that changes one of the values of a tile in the chunk.
+     */
+    const tile_glyph &get_tile_glyph( int x, int y, int z ) const;
 
     bool has_note(int x, int y, int z) const;
     std::string const& note(int x, int y, int z) const;
@@ -198,13 +243,20 @@ class overmap
 
     /**
      * Getter for overmap scents.
-     * @returns a reference to a scent_trace from the requested location.
+     * @returns The scent_trace at the requested location (absolute overmap terrain
+     * coordinates), its strength is what is left after spreading and fading.
      */
-    const scent_trace &scent_at( const tripoint &loc ) const;
+    scent_trace scent_at( const tripoint &loc ) const;
     /**
      * Setter for overmap scents, stores the provided scent at the provided location.
+     * A weaker scent doesn't replace a stronger one.
      */
     void set_scent( const tripoint &loc, scent_trace &new_scent );
+    /**
+     * Let the scents spread to the adjacent tiles and fade, this is called by
+     * @ref move_hordes. Layers without any scent left are dropped.
+     */
+    void diffuse_scents();
 
     /**
      * @returns Whether @param loc is within desired bounds of the overmap
@@ -275,7 +327,7 @@ class overmap
   }
     void clear_mon_groups();
 private:
-    std::multimap<tripoint, mongroup> zg;
+    mongroup_map zg;
 public:
     /** Unit test enablers to check if a given mongroup is present. */
     bool mongroup_check(const mongroup &candidate) const;
@@ -289,14 +341,17 @@ public:
   std::vector<city> cities;
   std::vector<city> roads_out;
 
+  // Number of chunks the layers are saved in, see @ref terrain_dirty.
+  static constexpr int layer_chunks = 3;
+
  private:
     friend class overmapbuffer;
 
-    bool nullbool = false;
     point loc{ 0, 0 };
 
     std::array<map_layer, OVERMAP_LAYERS> layer;
-    std::unordered_map<tripoint, scent_trace> scents;
+    /** Only z-levels that have scent on them. */
+    std::map<int, scent_layer> scents;
 
     /**
      * When monsters despawn during map-shifting they will be added here.
@@ -307,6 +362,41 @@ public:
     std::unordered_multimap<tripoint, monster> monster_map;
     regional_settings settings;
 
+    /**
+     * The terrain and the view data of the layers are saved in separate files (chunks
+     * of consecutive layers: below ground, ground level, above ground), so changing
+     * one layer only rewrites the files of its chunk.
+     * The layers are marked dirty by the setters (@ref set_ter, @ref set_seen etc.).
+     * Before a dirty chunk is written, its content is compared with the hash of what
+     * was last read or written, as a tile may have been changed back.
+     * Monster groups, NPCs and vehicles are not tracked this way, as they change
+     * (e.g. NPCs move) without the overmap knowing. They are saved in the main file,
+     * which is only written when its content changed.
+     */
+    mutable std::array<bool, OVERMAP_LAYERS> terrain_dirty;
+    mutable std::array<bool, OVERMAP_LAYERS> view_dirty;
+    mutable std::array<size_t, layer_chunks> terrain_chunk_hash;
+    mutable std::array<size_t, layer_chunks> view_chunk_hash;
+    mutable size_t main_hash = 0;
+    /**
+     * Positions of the terrain on each layer, grouped by the oter_id. It's built when
+     * the layer is first searched and kept up to date by @ref set_ter. An empty vector means it has not been built.
+     */
+    mutable std::array<std::vector<std::vector<point>>, OVERMAP_LAYERS> terrain_index;
+    const std::vector<std::vector<point>> &get_terrain_index( int z ) const;
+    /** Chunks of @ref tile_glyph, an empty vector means the chunk has not been built. */
+    static constexpr int glyph_chunk_size = 30;
+    static constexpr int glyph_chunks = OMAPX / glyph_chunk_size;
+    mutable std::array<std::vector<tile_glyph>, OVERMAP_LAYERS * glyph_chunks * glyph_chunks> glyph_cache;
+    /** Drop the glyphs of the chunk containing the tile (local coordinates). */
+    void invalidate_glyph( int x, int y, int z ) const;
+    /** Drop all glyphs of the layers in [first_layer, last_layer) (layer indices, not z). */
+    void clear_glyph_cache( int first_layer, int last_layer ) const;
+    /** First layer (index into @ref layer) of the chunk, or OVERMAP_LAYERS for chunk == layer_chunks. */
+    static int chunk_first_layer( int chunk );
+    /** @return Whether obsolete terrain had to be converted. */
+    bool unserialize_layers( JsonIn &jsin, int first_layer, int last_layer );
+
   // Initialise
   void init_layers();
   // open existing overmap, or generate a new one
@@ -316,10 +406,16 @@ public:
   void unserialize(std::istream &fin);
   // Parse per-player overmap view data.
   void unserialize_view(std::istream &fin);
-  // Save data in an opened overmap file
-  void serialize(std::ostream &fin) const;
+  // Save data in an opened overmap file, the terrain layers are omitted if include_layers is false
+  void serialize(std::ostream &fin, bool include_layers = true) const;
   // Save per-player overmap view data.
   void serialize_view(std::ostream &fin) const;
+  // Save / parse the terrain of the layers in one chunk.
+  void serialize_layer_chunk(std::ostream &fout, int chunk) const;
+  void unserialize_layer_chunk(std::istream &fin, int chunk);
+  // Save / parse per-player view data of the layers in one chunk.
+  void serialize_view_chunk(std::ostream &fout, int chunk) const;
+  void unserialize_view_chunk(std::istream &fin, int chunk);
   // parse data in an old overmap file
   void unserialize_legacy(std::istream &fin);
   void unserialize_view_legacy(std::istream &fin);
@@ -331,7 +427,19 @@ public:
 
     void signal_hordes( const tripoint &p, int sig_power );
     void process_mongroups();
+    /**
+     * Hordes that leave the overmap keep their position relative to it, and
+     * @ref overmapbuffer::move_hordes hands them to the adjacent overmap afterwards.
+     */
     void move_hordes();
+    /**
+     * Let the monsters in @ref monster_map drift to adjacent submaps now and then.
+     * @param bubble_min,bubble_size The reality bubble, in submaps relative to this overmap.
+     * Monsters are only spawned when their submap is loaded, so they don't drift into it.
+     * They keep their position on the submap, @ref overmapbuffer::spawn_monster moves them
+     * to a free spot if it's blocked.
+     */
+    void wander_monsters( const point &bubble_min, int bubble_size );
 
     static bool obsolete_terrain( const std::string &ter );
     void convert_terrain( const std::unordered_map<tripoint, std::string> &needs_conversion );
@@ -437,5 +545,7 @@ void finalize();
 
 bool is_river(const oter_id &ter);
 bool is_ot_type(const std::string &otype, const oter_id &oter);
+/** All overmap terrain types that match @p otype according to @ref is_ot_type. */
+std::vector<oter_id> find_ot_types(const std::string &otype);
 
 #endif
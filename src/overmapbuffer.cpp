@@ -14,6 +14,10 @@
 #include "vehicle.h"
 #include "filesystem.h"
 #include "cata_utility.h"
+#include "compatibility.h"
+#include "file_prefetch.h"
+#include "line.h"
+#include "rng.h"
 
 #include <algorithm>
 #include <cassert>
@@ -22,8 +26,17 @@
 
 overmapbuffer overmap_buffer;
 
+// Each overmap consists of up to 8 files, and the reality bubble overlaps at most 4 overmaps.
+static constexpr size_t max_prefetched_overmap_files = 8 * 4;
+static constexpr size_t prefetch_workers = 4;
+
 overmapbuffer::overmapbuffer()
 : last_requested_overmap( nullptr )
+, prefetcher( new file_prefetcher( prefetch_workers, max_prefetched_overmap_files ) )
+{
+}
+
+overmapbuffer::~overmapbuffer()
 {
 }
 
@@ -47,6 +60,52 @@ std::string overmapbuffer::player_filename(int const x, int const y)
     return filename.str();
 }
 
+std::string overmapbuffer::terrain_chunk_filename(int const x, int const y, int const chunk)
+{
+    return terrain_filename( x, y ) + ".layers" + to_string( chunk );
+}
+
+std::string overmapbuffer::player_chunk_filename(int const x, int const y, int const chunk)
+{
+    return player_filename( x, y ) + ".layers" + to_string( chunk );
+}
+
+/** All files of the overmap, in the order in which overmap::open reads them. */
+static std::vector<std::string> overmap_files( const int x, const int y )
+{
+    std::vector<std::string> result;
+    result.push_back( overmapbuffer::terrain_filename( x, y ) );
+    for( int chunk = 0; chunk < overmap::layer_chunks; ++chunk ) {
+        result.push_back( overmapbuffer::terrain_chunk_filename( x, y, chunk ) );
+    }
+    for( int chunk = 0; chunk < overmap::layer_chunks; ++chunk ) {
+        result.push_back( overmapbuffer::player_chunk_filename( x, y, chunk ) );
+    }
+    result.push_back( overmapbuffer::player_filename( x, y ) );
+    return result;
+}
+
+void overmapbuffer::prefetch( const std::vector<point> &oms )
+{
+    if( world_generator->active_world == nullptr ) {
+        return;
+    }
+    for( const point &om : oms ) {
+        if( overmaps.count( om ) > 0 || known_non_existing.count( om ) > 0 ) {
+            continue;
+        }
+        for( const std::string &path : overmap_files( om.x, om.y ) ) {
+            prefetcher->request( path );
+        }
+    }
+}
+
+bool overmapbuffer::read_file_optional( const std::string &path,
+                                        const std::function<void( std::istream & )> &reader )
+{
+    return prefetcher->read_optional( path, reader );
+}
+
 overmap &overmapbuffer::get( const int x, const int y )
 {
     point const p {x, y};
@@ -64,6 +123,11 @@ overmap &overmapbuffer::get( const int x, const int y )
     std::unique_ptr<overmap> new_om( new overmap( x, y ) );
     overmap &result = *new_om;
     overmaps[ new_om->pos() ] = std::move( new_om );
+    // Not all of the files are read (e.g. if the overmap had to be generated), the rest
+    // would become outdated once the overmap is saved.
+    for( const std::string &path : overmap_files( x, y ) ) {
+        prefetcher->discard( path );
+    }
     // Note: fix_mongroups might load other overmaps, so overmaps.back() is not
     // necessarily the overmap at (x,y)
     fix_mongroups( result );
@@ -74,33 +138,45 @@ overmap &overmapbuffer::get( const int x, const int y )
 
 void overmapbuffer::fix_mongroups(overmap &new_overmap)
 {
-    for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ) {
-        auto &mg = it->second;
+    // Finding the overmap a group belongs to may load that overmap, which can in turn
+    // add groups to this one. So first decide, then remove, then add them elsewhere.
+    std::vector<size_t> removed;
+    std::vector<std::pair<point, mongroup>> moved;
+    const mongroup_map &groups = new_overmap.zg;
+    const size_t count = groups.size();
+    for( size_t i = 0; i < count; i++ ) {
         // spawn related code simply sets population to 0 when they have been
         // transformed into spawn points on a submap, the group can then be removed
-        if( mg.empty() ) {
-            new_overmap.zg.erase( it++ );
+        if( groups[i].empty() ) {
+            removed.push_back( i );
             continue;
         }
         // Inside the bounds of the overmap?
-        if( mg.pos.x >= 0 && mg.pos.y >= 0 && mg.pos.x < OMAPX * 2 && mg.pos.y < OMAPY * 2 ) {
-            ++it;
+        const tripoint pos = groups[i].pos;
+        if( pos.x >= 0 && pos.y >= 0 && pos.x < OMAPX * 2 && pos.y < OMAPY * 2 ) {
             continue;
         }
-        point smabs( mg.pos.x + new_overmap.pos().x * OMAPX * 2,
-                     mg.pos.y + new_overmap.pos().y * OMAPY * 2 );
+        point smabs( pos.x + new_overmap.pos().x * OMAPX * 2,
+                     pos.y + new_overmap.pos().y * OMAPY * 2 );
         point omp = sm_to_om_remain( smabs );
+        // Copied before has() might add groups (and reallocate).
+        mongroup mg( groups[i] );
         if( !has( omp.x, omp.y ) ) {
             // Don't generate new overmaps, as this can be called from the
             // overmap-generating code.
-            ++it;
             continue;
         }
-        overmap &om = get( omp.x, omp.y );
+        // The target is relative to the overmap as well.
+        mg.target.x += ( new_overmap.pos().x - omp.x ) * OMAPX * 2;
+        mg.target.y += ( new_overmap.pos().y - omp.y ) * OMAPY * 2;
         mg.pos.x = smabs.x;
         mg.pos.y = smabs.y;
-        om.add_mon_group( mg );
-        new_overmap.zg.erase( it++ );
+        removed.push_back( i );
+        moved.emplace_back( omp, mg );
+    }
+    new_overmap.zg.erase( removed );
+    for( const auto &e : moved ) {
+        get( e.first.x, e.first.y ).add_mon_group( e.second );
     }
 }
 
@@ -117,6 +193,7 @@ void overmapbuffer::clear()
     overmaps.clear();
     known_non_existing.clear();
     last_requested_overmap = NULL;
+    prefetcher->clear();
 }
 
 const regional_settings& overmapbuffer::get_settings(int x, int y, int z)
@@ -237,7 +314,7 @@ bool overmapbuffer::is_explored(int x, int y, int z)
 void overmapbuffer::toggle_explored(int x, int y, int z)
 {
     overmap &om = get_om_global(x, y);
-    om.explored(x, y, z) = !om.explored(x, y, z);
+    om.set_explored(x, y, z, !om.is_explored(x, y, z));
 }
 
 bool overmapbuffer::has_horde(int const x, int const y, int const z) {
@@ -315,9 +392,51 @@ void overmapbuffer::move_hordes()
     // arbitrary radius to include nearby overmaps (aside from the current one)
     const auto radius = MAPSIZE * 2;
     const auto center = g->u.global_sm_location();
-    for( auto &om : get_overmaps_near( center, radius ) ) {
+    const auto overmaps_near = get_overmaps_near( center, radius );
+    for( auto &om : overmaps_near ) {
         om->move_hordes();
     }
+    // Hordes that crossed the border are only handed over now, so they don't move twice.
+    for( auto &om : overmaps_near ) {
+        fix_mongroups( *om );
+    }
+}
+
+void overmapbuffer::process_abstract()
+{
+    // Submaps an inactive npc travels per call, and how far the noise it makes carries.
+    static const int npc_travel_distance = 4;
+    static const int npc_noise = 2;
+
+    const tripoint bubble = g->m.get_abs_sub();
+    const int bubble_size = g->m.getmapsize();
+    std::vector<npc *> travelers;
+    for( auto &it : overmaps ) {
+        overmap &om = *it.second;
+        const point base = om_to_sm_copy( om.pos() );
+        om.wander_monsters( point( bubble.x - base.x, bubble.y - base.y ), bubble_size );
+        for( npc *guy : om.npcs ) {
+            if( guy->goal != npc::no_goal_point && !guy->is_dead() && !guy->is_active() ) {
+                travelers.push_back( guy );
+            }
+        }
+    }
+    // Collected first, as traveling may move an npc to another overmap.
+    bool entered_bubble = false;
+    for( npc *guy : travelers ) {
+        if( !guy->travel_abstract( npc_travel_distance ) ) {
+            continue;
+        }
+        const tripoint sm = guy->global_sm_location();
+        signal_hordes( sm, npc_noise );
+        if( sm.x >= bubble.x && sm.x < bubble.x + bubble_size &&
+            sm.y >= bubble.y && sm.y < bubble.y + bubble_size ) {
+            entered_bubble = true;
+        }
+    }
+    if( entered_bubble ) {
+        g->set_npcs_dirty();
+    }
 }
 
 std::vector<mongroup*> overmapbuffer::monsters_at(int x, int y, int z)
@@ -345,12 +464,11 @@ std::vector<mongroup*> overmapbuffer::groups_at(int x, int y, int z)
     }
     const tripoint dpos( x, y, z );
     overmap &om = get( omp.x, omp.y );
-    for( auto it = om.zg.lower_bound( dpos ), end = om.zg.upper_bound( dpos ); it != end; ++it ) {
-        auto &mg = it->second;
-        if( mg.empty() ) {
+    for( mongroup *mg : om.zg.at( dpos ) ) {
+        if( mg->empty() ) {
             continue;
         }
-        result.push_back( &mg );
+        result.push_back( mg );
     }
     return result;
 }
@@ -396,10 +514,13 @@ void overmapbuffer::move_vehicle( vehicle *veh, const point &old_msp )
     overmap &new_om = get_om_global( new_omt.x, new_omt.y );
     // *_omt is now local to the overmap, and it's in overmap terrain system
     if( &old_om == &new_om ) {
-        new_om.vehicles[veh->om_id].x = new_omt.x;
-        new_om.vehicles[veh->om_id].y = new_omt.y;
+        om_vehicle &tracked_veh = new_om.vehicles[veh->om_id];
+        new_om.invalidate_glyph( tracked_veh.x, tracked_veh.y, 0 );
+        tracked_veh.x = new_omt.x;
+        tracked_veh.y = new_omt.y;
+        new_om.invalidate_glyph( tracked_veh.x, tracked_veh.y, 0 );
     } else {
-        old_om.vehicles.erase( veh->om_id );
+        remove_tracked_vehicle( old_om, veh->om_id );
         add_vehicle( veh );
     }
 }
@@ -408,7 +529,16 @@ void overmapbuffer::remove_vehicle( const vehicle *veh )
 {
     const point omt = ms_to_omt_copy( veh->real_global_pos() );
     overmap &om = get_om_global( omt );
-    om.vehicles.erase( veh->om_id );
+    remove_tracked_vehicle( om, veh->om_id );
+}
+
+void overmapbuffer::remove_tracked_vehicle( overmap &om, const int id )
+{
+    const auto iter = om.vehicles.find( id );
+    if( iter != om.vehicles.end() ) {
+        om.invalidate_glyph( iter->second.x, iter->second.y, 0 );
+        om.vehicles.erase( iter );
+    }
 }
 
 void overmapbuffer::add_vehicle( vehicle *veh )
@@ -425,23 +555,29 @@ void overmapbuffer::add_vehicle( vehicle *veh )
     tracked_veh.y = omt.y;
     tracked_veh.name = veh->name;
     veh->om_id = id;
+    om.invalidate_glyph( omt.x, omt.y, 0 );
 }
 
 bool overmapbuffer::seen(int x, int y, int z)
 {
     const overmap *om = get_existing_om_global(x, y);
-    return (om != NULL) && const_cast<overmap*>(om)->seen(x, y, z);
+    return (om != NULL) && om->seen(x, y, z);
 }
 
 void overmapbuffer::set_seen(int x, int y, int z, bool seen)
 {
     overmap &om = get_om_global(x, y);
-    om.seen(x, y, z) = seen;
+    om.set_seen(x, y, z, seen);
 }
 
-oter_id& overmapbuffer::ter(int x, int y, int z) {
+const oter_id& overmapbuffer::ter(int x, int y, int z) {
+    const overmap &om = get_om_global(x, y);
+    return om.get_ter(x, y, z);
+}
+
+void overmapbuffer::set_ter(int x, int y, int z, const oter_id &id) {
     overmap &om = get_om_global(x, y);
-    return om.ter(x, y, z);
+    om.set_ter(x, y, z, id);
 }
 
 bool overmapbuffer::reveal(const point &center, int radius, int z)
@@ -516,51 +652,48 @@ bool overmapbuffer::check_ot_type(const std::string& type, int x, int y, int z)
 
 tripoint overmapbuffer::find_closest(const tripoint& origin, const std::string& type, int const radius, bool must_be_seen)
 {
-    int max = (radius == 0 ? OMAPX : radius);
-    const int z = origin.z;
-    // expanding box
-    for( int dist = 0; dist <= max; dist++) {
-        // each edge length is 2*dist-2, because corners belong to one edge
-        // south is +y, north is -y
-        for (int i = 0; i < dist*2-1; i++) {
-            //start at northwest, scan north edge
-            int x = origin.x - dist + i;
-            int y = origin.y - dist;
-            if (check_ot_type(type, x, y, z)) {
-                if (!must_be_seen || seen(x, y, z)) {
-                    return tripoint( x, y, z );
-                }
-            }
-
-            //start at southeast, scan south
-            x = origin.x + dist - i;
-            y = origin.y + dist;
-            if (check_ot_type(type, x, y, z)) {
-                if (!must_be_seen || seen(x, y, z)) {
-                    return tripoint( x, y, z );
-                }
-            }
+    const int max = (radius == 0 ? OMAPX : radius);
+    tripoint result = overmap::invalid_tripoint;
+    const std::vector<oter_id> types = find_ot_types( type );
+    if( types.empty() ) {
+        return result;
+    }
+    // The overmaps that overlap the search area, nearest first. Each one is only loaded (or
+    // generated) if it can still contain something closer than the best match so far.
+    std::vector<std::pair<int, point>> oms;
+    const point om_min = omt_to_om_copy( origin.x - max, origin.y - max );
+    const point om_max = omt_to_om_copy( origin.x + max, origin.y + max );
+    for( int omx = om_min.x; omx <= om_max.x; omx++ ) {
+        for( int omy = om_min.y; omy <= om_max.y; omy++ ) {
+            const int dx = std::max( { omx * OMAPX - origin.x, origin.x - ( omx + 1 ) * OMAPX + 1, 0 } );
+            const int dy = std::max( { omy * OMAPY - origin.y, origin.y - ( omy + 1 ) * OMAPY + 1, 0 } );
+            oms.emplace_back( std::max( dx, dy ), point( omx, omy ) );
+        }
+    }
+    std::sort( oms.begin(), oms.end() );
 
-            //start at southwest, scan west
-            x = origin.x - dist;
-            y = origin.y + dist - i;
-            if (check_ot_type(type, x, y, z)) {
-                if (!must_be_seen || seen(x, y, z)) {
-                    return tripoint( x, y, z );
-                }
+    // Closest in terms of the square around origin, ties go to the smallest x, then y.
+    int result_dist = max + 1;
+    for( const auto &e : oms ) {
+        if( e.first > result_dist ) {
+            break;
+        }
+        const overmap &om = get( e.second.x, e.second.y );
+        const point base = om.global_base_point();
+        for( const point &p : om.find_ot_types( types, origin.z ) ) {
+            const tripoint pos( base.x + p.x, base.y + p.y, origin.z );
+            const int dist = square_dist( origin.x, origin.y, pos.x, pos.y );
+            if( dist > max || dist > result_dist || ( dist == result_dist && !( pos < result ) ) ) {
+                continue;
             }
-
-            //start at northeast, scan east
-            x = origin.x + dist;
-            y = origin.y - dist + i;
-            if (check_ot_type(type, x, y, z)) {
-                if (!must_be_seen || seen(x, y, z)) {
-                    return tripoint( x, y, z );
-                }
+            if( must_be_seen && !om.seen( p.x, p.y, origin.z ) ) {
+                continue;
             }
+            result_dist = dist;
+            result = pos;
         }
     }
-    return overmap::invalid_tripoint;
+    return result;
 }
 
 std::vector<tripoint> overmapbuffer::find_all( const tripoint& origin, const std::string& type,
@@ -569,16 +702,35 @@ std::vector<tripoint> overmapbuffer::find_all( const tripoint& origin, const std
     std::vector<tripoint> result;
     // dist == 0 means search a whole overmap diameter.
     dist = dist ? dist : OMAPX;
-    for (int x = origin.x - dist; x <= origin.x + dist; x++) {
-        for (int y = origin.y - dist; y <= origin.y + dist; y++) {
-            if (must_be_seen && !seen(x, y, origin.z)) {
-                continue;
-            }
-            if (check_ot_type(type, x, y, origin.z)) {
+    const std::vector<oter_id> types = find_ot_types( type );
+    if( types.empty() ) {
+        return result;
+    }
+    // Look the terrain up in the index of each overmap that overlaps the search area
+    // instead of checking every position in it.
+    const point om_min = omt_to_om_copy( origin.x - dist, origin.y - dist );
+    const point om_max = omt_to_om_copy( origin.x + dist, origin.y + dist );
+    for( int omx = om_min.x; omx <= om_max.x; omx++ ) {
+        for( int omy = om_min.y; omy <= om_max.y; omy++ ) {
+            overmap &om = get( omx, omy );
+            const point base = om.global_base_point();
+            for( const point &p : om.find_ot_types( types, origin.z ) ) {
+                const int x = base.x + p.x;
+                const int y = base.y + p.y;
+                if( abs( x - origin.x ) > dist || abs( y - origin.y ) > dist ) {
+                    continue;
+                }
+                if( must_be_seen && !om.seen( p.x, p.y, origin.z ) ) {
+                    continue;
+                }
                 result.push_back( tripoint( x, y, origin.z ) );
             }
         }
     }
+    // Same order as scanning the area row by row, so results don't depend on the index.
+    std::sort( result.begin(), result.end(), []( const tripoint &a, const tripoint &b ) {
+        return a.x != b.x ? a.x < b.x : a.y < b.y;
+    } );
     return result;
 }
 
@@ -797,8 +949,22 @@ void overmapbuffer::spawn_monster(const int x, const int y, const int z)
         ms.x += x * SEEX;
         ms.y += y * SEEY;
         // The monster position must be local to the main map when added via game::add_zombie
-        const tripoint local = tripoint( g->m.getlocal( ms.x, ms.y ), z );
+        const tripoint base = tripoint( g->m.getlocal( x * SEEX, y * SEEY ), z );
+        tripoint local = tripoint( g->m.getlocal( ms.x, ms.y ), z );
         assert( g->m.inbounds( local ) );
+        // Monsters that wandered here (see overmap::wander_monsters) kept their position
+        // on the submap they came from, which may be a wall here. Same as the spawns of
+        // the submap, look for a free spot nearby and drop the monster if there is none.
+        // Pets and mission targets don't wander, they are placed anyway.
+        int tries = 0;
+        while( ( !g->is_empty( local ) || !this_monster.can_move_to( local ) ) && tries < 10 ) {
+            local.x = base.x + modulo( local.x - base.x + rng( -3, 3 ), SEEX );
+            local.y = base.y + modulo( local.y - base.y + rng( -3, 3 ), SEEY );
+            tries++;
+        }
+        if( tries == 10 && this_monster.friendly == 0 && this_monster.mission_id == -1 ) {
+            return;
+        }
         this_monster.spawn( local );
         g->add_zombie( this_monster );
     } );
@@ -10,6 +10,8 @@
 #include <memory>
 #include <vector>
 #include <unordered_map>
+#include <functional>
+#include <iosfwd>
 
 struct mongroup;
 class monster;
@@ -20,6 +22,7 @@ struct oter_t;
 using oter_id = int_id<oter_t>;
 
 class overmap;
+class file_prefetcher;
 struct radio_tower;
 struct regional_settings;
 class vehicle;
@@ -56,9 +59,26 @@ class overmapbuffer
 {
 public:
     overmapbuffer();
+    ~overmapbuffer();
 
     static std::string terrain_filename(int const x, int const y);
     static std::string player_filename(int const x, int const y);
+    /** Files holding the terrain / the player view of one chunk of layers of the overmap. */
+    static std::string terrain_chunk_filename(int const x, int const y, int const chunk);
+    static std::string player_chunk_filename(int const x, int const y, int const chunk);
+
+    /**
+     * Start reading the files of the given overmaps (in overmap coordinates) on background
+     * threads, so creating those overmaps later doesn't have to wait for the disk.
+     * Loaded overmaps are ignored.
+     */
+    void prefetch( const std::vector<point> &oms );
+    /**
+     * Read one of the files of an overmap (see @ref terrain_filename and friends), using
+     * the data from @ref prefetch if it's there. Same semantic as read_from_file_optional.
+     */
+    bool read_file_optional( const std::string &path,
+                             const std::function<void( std::istream & )> &reader );
 
     /**
      * Uses overmap coordinates, that means x and y are directly
@@ -72,8 +92,13 @@ public:
      * Uses global overmap terrain coordinates, creates the
      * overmap if needed.
      */
-    oter_id& ter(int x, int y, int z);
-    oter_id& ter(const tripoint& p) { return ter(p.x, p.y, p.z); }
+    const oter_id& ter(int x, int y, int z);
+    const oter_id& ter(const tripoint& p) { return ter(p.x, p.y, p.z); }
+    /**
+     * Changes the terrain, same coordinates as @ref ter.
+     */
+    void set_ter(int x, int y, int z, const oter_id &id);
+    void set_ter(const tripoint &p, const oter_id &id) { set_ter(p.x, p.y, p.z, id); }
     /**
      * Uses global overmap terrain coordinates.
      */
@@ -217,6 +242,9 @@ public:
      * @param origin uses overmap terrain coordinates.
      * @param must_be_seen If true, only terrain seen by the player
      * should be searched.
+     * The distance is measured as a square around origin, which itself is included.
+     * Of several tiles at the same distance, the one with the smallest x (and then y)
+     * is returned.
      */
     tripoint find_closest(const tripoint& origin, const std::string& type, int radius, bool must_be_seen);
 
@@ -273,6 +301,14 @@ public:
      * therefor you should probably call @ref map::spawn_monsters to spawn them.
      */
     void move_hordes();
+    /**
+     * Coarse simulation of the world outside of the reality bubble, which is run much
+     * less often than the game turns (see game::do_turn) and only moves things around
+     * between submaps: stored monsters wander (see @ref overmap::wander_monsters) and
+     * inactive npcs travel towards their goal, which attracts nearby hordes.
+     * Their needs are caught up by @ref npc::on_load, when they are loaded again.
+     */
+    void process_abstract();
     // hordes -- this uses overmap terrain coordinates!
     std::vector<mongroup*> monsters_at(int x, int y, int z);
     /**
@@ -319,6 +355,7 @@ private:
     mutable std::set<point> known_non_existing;
     // Cached result of previous call to overmapbuffer::get_existing
     overmap mutable *last_requested_overmap;
+    std::unique_ptr<file_prefetcher> prefetcher;
 
     /**
      * Get a list of notes in the (loaded) overmaps.
@@ -340,6 +377,8 @@ private:
      * groups to the correct overmap (if it exists), also removes empty groups.
      */
     void fix_mongroups(overmap &new_overmap);
+    /** Stop tracking the vehicle with the given id in that overmap, if it is tracked there. */
+    void remove_tracked_vehicle( overmap &om, int id );
     /**
      * Retrieve overmaps that overlap the bounding box defined by the location and radius.
      * The location is in absolute submap coordinates, the radius is in the same system.
@@ -108,6 +108,7 @@ void PATH_INFO::update_config_dir()
     update_pathname("autopickup", FILENAMES["config_dir"] + "auto_pickup.json");
     update_pathname("safemode", FILENAMES["config_dir"] + "safemode.json");
     update_pathname("custom_colors", FILENAMES["config_dir"] + "custom_colors.json");
+    update_pathname("checked_data", FILENAMES["config_dir"] + "checked_data.txt");
 }
 
 void PATH_INFO::set_standard_filenames(void)
@@ -187,6 +188,7 @@ void PATH_INFO::set_standard_filenames(void)
     update_pathname("autopickup", FILENAMES["config_dir"] + "auto_pickup.json");
     update_pathname("safemode", FILENAMES["config_dir"] + "safemode.json");
     update_pathname("custom_colors", FILENAMES["config_dir"] + "custom_colors.json");
+    update_pathname("checked_data", FILENAMES["config_dir"] + "checked_data.txt");
     update_pathname("worldoptions", "worldoptions.json");
 
     // Needed to move files from these legacy locations to the new config directory.
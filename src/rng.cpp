@@ -8,18 +8,41 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 
+// Engine of the innermost rng_seed_scope of this thread, if any.
+static thread_local std::minstd_rand *scoped_engine = nullptr;
+
+// Uniformly distributed in [0, 1).
+static double rng_unit()
+{
+    if( scoped_engine != nullptr ) {
+        return double( ( *scoped_engine )() - std::minstd_rand::min() ) /
+               ( double( std::minstd_rand::max() - std::minstd_rand::min() ) + 1.0 );
+    }
+    return double( rand() ) / double( RAND_MAX + 1.0 );
+}
+
+rng_seed_scope::rng_seed_scope( const unsigned int seed ) : engine( seed ), previous( scoped_engine )
+{
+    scoped_engine = &engine;
+}
+
+rng_seed_scope::~rng_seed_scope()
+{
+    scoped_engine = previous;
+}
+
 long rng( long val1, long val2 )
 {
     long minVal = ( val1 < val2 ) ? val1 : val2;
     long maxVal = ( val1 < val2 ) ? val2 : val1;
-    return minVal + long( ( maxVal - minVal + 1 ) * double( rand() / double( RAND_MAX + 1.0 ) ) );
+    return minVal + long( ( maxVal - minVal + 1 ) * rng_unit() );
 }
 
 double rng_float( double val1, double val2 )
 {
     double minVal = ( val1 < val2 ) ? val1 : val2;
     double maxVal = ( val1 < val2 ) ? val2 : val1;
-    return minVal + ( maxVal - minVal ) * double( rand() ) / double( RAND_MAX + 1.0 );
+    return minVal + ( maxVal - minVal ) * rng_unit();
 }
 
 bool one_in( int chance )
@@ -35,7 +58,7 @@ bool one_in_improved( double chance )
 
 bool x_in_y( double x, double y )
 {
-    return ( ( double )rand() / RAND_MAX ) <= ( ( double )x / y );
+    return rng_unit() <= ( ( double )x / y );
 }
 
 int dice( int number, int sides )
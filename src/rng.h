@@ -4,6 +4,8 @@
 #include "compatibility.h"
 
 #include <functional>
+#include <iterator>
+#include <random>
 
 long rng( long val1, long val2 );
 double rng_float( double val1, double val2 );
@@ -28,6 +30,41 @@ inline double rng_normal( double hi )
 
 double normal_roll( double mean, double stddev );
 
+/**
+ * While an object of this class exists, @ref rng, @ref rng_float, @ref x_in_y and everything
+ * based on them draw their numbers on the current thread from a private engine seeded with
+ * the given seed, instead of from the global rand() state.
+ * This makes the results reproducible, e.g. a map quad only depends on the game seed and its
+ * position (see @ref map::generation_seed), and the game's own random sequence stays
+ * untouched. Scopes can be nested.
+ */
+class rng_seed_scope
+{
+    public:
+        explicit rng_seed_scope( unsigned int seed );
+        ~rng_seed_scope();
+
+        rng_seed_scope( const rng_seed_scope & ) = delete;
+        rng_seed_scope &operator=( const rng_seed_scope & ) = delete;
+
+    private:
+        std::minstd_rand engine;
+        std::minstd_rand *previous;
+};
+
+/**
+ * Randomly reorders the range, like std::random_shuffle, but uses @ref rng, so it is
+ * affected by @ref rng_seed_scope.
+ */
+template<typename Iter>
+inline void random_shuffle_rng( Iter first, Iter last )
+{
+    const auto count = std::distance( first, last );
+    for( long i = long( count ) - 1; i > 0; --i ) {
+        std::iter_swap( std::next( first, i ), std::next( first, rng( 0, i ) ) );
+    }
+}
+
 /**
  * Returns a random entry in the container.
  * The container must have a `size()` function and must support iterators as usual.
@@ -322,7 +322,6 @@ void overmap::convert_terrain( const std::unordered_map<tripoint, std::string> &
     for( const auto &convert : needs_conversion ) {
         const tripoint pos = convert.first;
         const std::string old = convert.second;
-        oter_id &new_id = ter( pos.x, pos.y, pos.z );
 
         struct convert_nearby {
             int xoffset;
@@ -431,13 +430,123 @@ void overmap::convert_terrain( const std::unordered_map<tripoint, std::string> &
             const auto y_it = needs_conversion.find( tripoint( pos.x, pos.y + conv.yoffset, pos.z ) );
             if( x_it != needs_conversion.end() && x_it->second == conv.x_id &&
                 y_it != needs_conversion.end() && y_it->second == conv.y_id ) {
-                new_id = oter_id( conv.new_id );
+                set_ter( pos.x, pos.y, pos.z, oter_id( conv.new_id ) );
                 break;
             }
         }
     }
 }
 
+bool overmap::unserialize_layers( JsonIn &jsin, const int first_layer, const int last_layer )
+{
+    for( int z = first_layer; z < last_layer; ++z ) {
+        terrain_index[z].clear();
+    }
+    clear_glyph_cache( first_layer, last_layer );
+    std::unordered_map<tripoint, std::string> needs_conversion;
+    jsin.start_array();
+    for( int z = first_layer; z < last_layer; ++z ) {
+        jsin.start_array();
+        int count = 0;
+        std::string tmp_ter;
+        oter_id tmp_otid(0);
+        for (int j = 0; j < OMAPY; j++) {
+            for (int i = 0; i < OMAPX; i++) {
+                if (count == 0) {
+                    jsin.start_array();
+                    jsin.read( tmp_ter );
+                    jsin.read( count );
+                    jsin.end_array();
+                    if( obsolete_terrain( tmp_ter ) ) {
+                        for( int p = i; p < i+count; p++ ) {
+                            needs_conversion.emplace( tripoint( p, j, z-OVERMAP_DEPTH ),
+                                                      tmp_ter );
+                        }
+                        tmp_otid = oter_id( 0 );
+                    } else if( oter_str_id( tmp_ter ).is_valid() ) {
+                        tmp_otid = oter_id( tmp_ter );
+                    } else {
+                        debugmsg("Loaded bad ter! ter %s", tmp_ter.c_str());
+                        tmp_otid = oter_id( 0 );
+                    }
+                }
+                count--;
+                layer[z].terrain[i][j] = tmp_otid;
+            }
+        }
+        jsin.end_array();
+    }
+    jsin.end_array();
+    convert_terrain( needs_conversion );
+    return !needs_conversion.empty();
+}
+
+// throws std::exception
+void overmap::unserialize_layer_chunk( std::istream &fin, const int chunk )
+{
+    const int first_layer = chunk_first_layer( chunk );
+    const int last_layer = chunk_first_layer( chunk + 1 );
+    bool loaded = false;
+    bool converted = false;
+    // Skip the version line
+    std::string vline;
+    getline( fin, vline );
+    JsonIn jsin( fin );
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        const std::string name = jsin.get_member_name();
+        if( name == "layers" ) {
+            converted = unserialize_layers( jsin, first_layer, last_layer );
+            loaded = true;
+        } else {
+            jsin.skip_value();
+        }
+    }
+    if( loaded && !converted ) {
+        std::fill( terrain_dirty.begin() + first_layer, terrain_dirty.begin() + last_layer, false );
+    }
+}
+
+/**
+ * Writes the values (as int) as a sequence of [value, count] pairs, one for each run of
+ * equal values. Most of a scent layer is empty, and the rest changes gradually.
+ */
+template<typename T>
+static void serialize_values_to_compacted_sequence( JsonOut &json, const std::vector<T> &values )
+{
+    json.start_array();
+    for( size_t i = 0; i < values.size(); ) {
+        const int value = static_cast<int>( values[i] );
+        int count = 0;
+        for( ; i < values.size() && static_cast<int>( values[i] ) == value; i++ ) {
+            count++;
+        }
+        json.start_array();
+        json.write( value );
+        json.write( count );
+        json.end_array();
+    }
+    json.end_array();
+}
+
+template<typename T>
+static void unserialize_values_from_compacted_sequence( JsonIn &jsin, std::vector<T> &values )
+{
+    size_t i = 0;
+    jsin.start_array();
+    while( !jsin.end_array() ) {
+        int value = 0;
+        int count = 0;
+        jsin.start_array();
+        jsin.read( value );
+        jsin.read( count );
+        jsin.end_array();
+        for( ; count > 0 && i < values.size(); count--, i++ ) {
+            values[i] = static_cast<T>( value );
+        }
+    }
+}
+
 // throws std::exception
 void overmap::unserialize( std::istream &fin ) {
 
@@ -461,41 +570,7 @@ void overmap::unserialize( std::istream &fin ) {
     while( !jsin.end_object() ) {
         const std::string name = jsin.get_member_name();
         if( name == "layers" ) {
-            std::unordered_map<tripoint, std::string> needs_conversion;
-            jsin.start_array();
-            for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-                jsin.start_array();
-                int count = 0;
-                std::string tmp_ter;
-                oter_id tmp_otid(0);
-                for (int j = 0; j < OMAPY; j++) {
-                    for (int i = 0; i < OMAPX; i++) {
-                        if (count == 0) {
-                            jsin.start_array();
-                            jsin.read( tmp_ter );
-                            jsin.read( count );
-                            jsin.end_array();
-                            if( obsolete_terrain( tmp_ter ) ) {
-                                for( int p = i; p < i+count; p++ ) {
-                                    needs_conversion.emplace( tripoint( p, j, z-OVERMAP_DEPTH ),
-                                                              tmp_ter );
-                                }
-                                tmp_otid = oter_id( 0 );
-                            } else if( oter_str_id( tmp_ter ).is_valid() ) {
-                                tmp_otid = oter_id( tmp_ter );
-                            } else {
-                                debugmsg("Loaded bad ter! ter %s", tmp_ter.c_str());
-                                tmp_otid = oter_id( 0 );
-                            }
-                        }
-                        count--;
-                        layer[z].terrain[i][j] = tmp_otid;
-                    }
-                }
-                jsin.end_array();
-            }
-            jsin.end_array();
-            convert_terrain( needs_conversion );
+            unserialize_layers( jsin, 0, OVERMAP_LAYERS );
         } else if( name == "region_id" ) {
             std::string new_region_id;
             jsin.read( new_region_id );
@@ -605,7 +680,28 @@ void overmap::unserialize( std::istream &fin ) {
                 }
                 vehicles[id] = new_tracker;
             }
+        } else if( name == "scent_layers" ) {
+            jsin.start_array();
+            while( !jsin.end_array() ) {
+                jsin.start_object();
+                scent_layer layer;
+                int z = 0;
+                while( !jsin.end_object() ) {
+                    const std::string layer_member_name = jsin.get_member_name();
+                    if( layer_member_name == "z" ) {
+                        jsin.read( z );
+                    } else if( layer_member_name == "turn" ) {
+                        unserialize_values_from_compacted_sequence( jsin, layer.turn );
+                    } else if( layer_member_name == "strength" ) {
+                        unserialize_values_from_compacted_sequence( jsin, layer.strength );
+                    } else {
+                        jsin.skip_value();
+                    }
+                }
+                scents[z] = std::move( layer );
+            }
         } else if( name == "scent_traces" ) {
+            // Saves from before the scent layers were compacted.
             jsin.start_array();
             while( !jsin.end_array() ) {
                 jsin.start_object();
@@ -622,7 +718,8 @@ void overmap::unserialize( std::istream &fin ) {
                         jsin.read( strength );
                     }
                 }
-                scents[pos] = scent_trace( time, strength );
+                scent_trace trace( time, strength );
+                set_scent( pos, trace );
             }
         } else if( name == "npcs" ) {
             jsin.start_array();
@@ -638,7 +735,7 @@ void overmap::unserialize( std::istream &fin ) {
     }
 }
 
-static void unserialize_array_from_compacted_sequence( JsonIn &jsin, bool (&array)[OMAPX][OMAPY] )
+static void unserialize_array_from_compacted_sequence( JsonIn &jsin, std::bitset<OMAPX * OMAPY> &array )
 {
     int count = 0;
     bool value = false;
@@ -651,8 +748,48 @@ static void unserialize_array_from_compacted_sequence( JsonIn &jsin, bool (&arra
                 jsin.end_array();
             }
             count--;
-            array[i][j] = value;
+            array[map_layer::tile( i, j )] = value;
+        }
+    }
+}
+
+static void unserialize_view_layers( JsonIn &jsin, const std::string &name,
+                                     std::array<map_layer, OVERMAP_LAYERS> &layer, const int first_layer, const int last_layer )
+{
+    if( name == "visible" ) {
+        jsin.start_array();
+        for( int z = first_layer; z < last_layer; ++z ) {
+            jsin.start_array();
+            unserialize_array_from_compacted_sequence( jsin, layer[z].visible );
+            jsin.end_array();
         }
+        jsin.end_array();
+    } else if( name == "explored") {
+        jsin.start_array();
+        for( int z = first_layer; z < last_layer; ++z ) {
+            jsin.start_array();
+            unserialize_array_from_compacted_sequence( jsin, layer[z].explored );
+            jsin.end_array();
+        }
+        jsin.end_array();
+    } else if( name == "notes") {
+        jsin.start_array();
+        for( int z = first_layer; z < last_layer; ++z ) {
+            jsin.start_array();
+            while( !jsin.end_array() ) {
+                om_note tmp;
+                jsin.start_array();
+                jsin.read(tmp.x);
+                jsin.read(tmp.y);
+                jsin.read(tmp.text);
+                jsin.end_array();
+
+                layer[z].notes.push_back(tmp);
+            }
+        }
+        jsin.end_array();
+    } else {
+        jsin.skip_value();
     }
 }
 
@@ -660,6 +797,7 @@ static void unserialize_array_from_compacted_sequence( JsonIn &jsin, bool (&arra
 void overmap::unserialize_view(std::istream &fin)
 {
     // Private/per-character view of the overmap.
+    clear_glyph_cache( 0, OVERMAP_LAYERS );
     if ( fin.peek() == '#' ) {
         // This was the last savegame version that produced the old format.
         static int overmap_legacy_save_version = 24;
@@ -678,49 +816,33 @@ void overmap::unserialize_view(std::istream &fin)
     JsonIn jsin( fin );
     jsin.start_object();
     while( !jsin.end_object() ) {
-        const std::string name = jsin.get_member_name();
-        if( name == "visible" ) {
-            jsin.start_array();
-            for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-                jsin.start_array();
-                unserialize_array_from_compacted_sequence( jsin, layer[z].visible );
-                jsin.end_array();
-            }
-            jsin.end_array();
-        } else if( name == "explored") {
-            jsin.start_array();
-            for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-                jsin.start_array();
-                unserialize_array_from_compacted_sequence( jsin, layer[z].explored );
-                jsin.end_array();
-            }
-            jsin.end_array();
-        } else if( name == "notes") {
-            jsin.start_array();
-            for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
-                jsin.start_array();
-                while( !jsin.end_array() ) {
-                    om_note tmp;
-                    jsin.start_array();
-                    jsin.read(tmp.x);
-                    jsin.read(tmp.y);
-                    jsin.read(tmp.text);
-                    jsin.end_array();
+        unserialize_view_layers( jsin, jsin.get_member_name(), layer, 0, OVERMAP_LAYERS );
+    }
+}
 
-                    layer[z].notes.push_back(tmp);
-                }
-            }
-            jsin.end_array();
-        }
+// throws std::exception
+void overmap::unserialize_view_chunk( std::istream &fin, const int chunk )
+{
+    const int first_layer = chunk_first_layer( chunk );
+    const int last_layer = chunk_first_layer( chunk + 1 );
+    clear_glyph_cache( first_layer, last_layer );
+    // Skip the version line
+    std::string vline;
+    getline( fin, vline );
+    JsonIn jsin( fin );
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        unserialize_view_layers( jsin, jsin.get_member_name(), layer, first_layer, last_layer );
     }
+    std::fill( view_dirty.begin() + first_layer, view_dirty.begin() + last_layer, false );
 }
 
-static void serialize_array_to_compacted_sequence( JsonOut &json, const bool (&array)[OMAPX][OMAPY] ) {
+static void serialize_array_to_compacted_sequence( JsonOut &json, const std::bitset<OMAPX * OMAPY> &array ) {
     int count = 0;
     int lastval = -1;
     for( int j = 0; j < OMAPY; j++ ) {
         for( int i = 0; i < OMAPX; i++ ) {
-            int value = array[i][j];
+            int value = array[map_layer::tile( i, j )];
             if( value != lastval ) {
                 if (count) {
                     json.write(count);
@@ -739,7 +861,8 @@ static void serialize_array_to_compacted_sequence( JsonOut &json, const bool (&a
     json.end_array();
 }
 
-void overmap::serialize_view( std::ostream &fout ) const
+static void serialize_view_layers( std::ostream &fout, const std::array<map_layer, OVERMAP_LAYERS> &layer,
+                                   const int first_layer, const int last_layer )
 {
     static const int first_overmap_view_json_version = 25;
     fout << "# version " << first_overmap_view_json_version << std::endl;
@@ -749,7 +872,7 @@ void overmap::serialize_view( std::ostream &fout ) const
 
     json.member("visible");
     json.start_array();
-    for (int z = 0; z < OVERMAP_LAYERS; ++z) {
+    for( int z = first_layer; z < last_layer; ++z ) {
         json.start_array();
         serialize_array_to_compacted_sequence( json, layer[z].visible );
         json.end_array();
@@ -759,7 +882,7 @@ void overmap::serialize_view( std::ostream &fout ) const
 
     json.member("explored");
     json.start_array();
-    for (int z = 0; z < OVERMAP_LAYERS; ++z) {
+    for( int z = first_layer; z < last_layer; ++z ) {
         json.start_array();
         serialize_array_to_compacted_sequence( json, layer[z].explored );
         json.end_array();
@@ -769,7 +892,7 @@ void overmap::serialize_view( std::ostream &fout ) const
 
     json.member("notes");
     json.start_array();
-    for (int z = 0; z < OVERMAP_LAYERS; ++z) {
+    for( int z = first_layer; z < last_layer; ++z ) {
         json.start_array();
         for (auto &i : layer[z].notes) {
             json.start_array();
@@ -786,17 +909,22 @@ void overmap::serialize_view( std::ostream &fout ) const
     json.end_object();
 }
 
-void overmap::serialize( std::ostream &fout ) const
+void overmap::serialize_view( std::ostream &fout ) const
 {
-    static const int first_overmap_json_version = 25;
-    fout << "# version " << first_overmap_json_version << std::endl;
+    serialize_view_layers( fout, layer, 0, OVERMAP_LAYERS );
+}
 
-    JsonOut json(fout, false);
-    json.start_object();
+void overmap::serialize_view_chunk( std::ostream &fout, const int chunk ) const
+{
+    serialize_view_layers( fout, layer, chunk_first_layer( chunk ), chunk_first_layer( chunk + 1 ) );
+}
 
+static void serialize_terrain_layers( JsonOut &json, std::ostream &fout,
+                                      const std::array<map_layer, OVERMAP_LAYERS> &layer, const int first_layer, const int last_layer )
+{
     json.member("layers");
     json.start_array();
-    for (int z = 0; z < OVERMAP_LAYERS; ++z) {
+    for( int z = first_layer; z < last_layer; ++z ) {
         int count = 0;
         oter_id last_tertype(-1);
         json.start_array();
@@ -826,6 +954,31 @@ void overmap::serialize( std::ostream &fout ) const
         fout << std::endl;
     }
     json.end_array();
+}
+
+void overmap::serialize_layer_chunk( std::ostream &fout, const int chunk ) const
+{
+    static const int first_overmap_json_version = 25;
+    fout << "# version " << first_overmap_json_version << std::endl;
+
+    JsonOut json(fout, false);
+    json.start_object();
+    serialize_terrain_layers( json, fout, layer, chunk_first_layer( chunk ), chunk_first_layer( chunk + 1 ) );
+    json.end_object();
+    fout << std::endl;
+}
+
+void overmap::serialize( std::ostream &fout, const bool include_layers ) const
+{
+    static const int first_overmap_json_version = 25;
+    fout << "# version " << first_overmap_json_version << std::endl;
+
+    JsonOut json(fout, false);
+    json.start_object();
+
+    if( include_layers ) {
+        serialize_terrain_layers( json, fout, layer, 0, OVERMAP_LAYERS );
+    }
 
     // temporary, to allow user to manually switch regions during play until regionmap is done.
     json.member("region_id", settings.id);
@@ -834,7 +987,7 @@ void overmap::serialize( std::ostream &fout ) const
     json.member("mongroups");
     json.start_array();
     for( const auto &group : zg ) {
-        json.write(group.second);
+        json.write(group);
     }
     json.end_array();
     fout << std::endl;
@@ -899,14 +1052,17 @@ void overmap::serialize( std::ostream &fout ) const
     json.end_array();
     fout << std::endl;
 
-    json.member("scent_traces");
+    json.member("scent_layers");
     json.start_array();
     for( const auto &scent : scents ) {
         json.start_object();
-        json.member( "pos", scent.first );
-        json.member( "time", scent.second.creation_turn );
-        json.member( "strength", scent.second.initial_strength );
+        json.member( "z", scent.first );
+        json.member( "turn" );
+        serialize_values_to_compacted_sequence( json, scent.second.turn );
+        json.member( "strength" );
+        serialize_values_to_compacted_sequence( json, scent.second.strength );
         json.end_object();
+        fout << std::endl;
     }
     json.end_array();
     fout << std::endl;
@@ -937,7 +1093,17 @@ void mongroup::serialize(JsonOut &json) const
     json.member("horde", horde);
     json.member("target", target);
     json.member("interest", interest);
-    json.member("horde_behaviour", horde_behaviour);
+    switch( horde_behaviour ) {
+        case behaviour::none:
+            json.member("horde_behaviour", "");
+            break;
+        case behaviour::city:
+            json.member("horde_behaviour", "city");
+            break;
+        case behaviour::roam:
+            json.member("horde_behaviour", "roam");
+            break;
+    }
     json.member("monsters");
     json.start_array();
     for( auto &i : monsters ) {
@@ -971,7 +1137,14 @@ void mongroup::deserialize(JsonIn &json)
         } else if( name == "interest" ) {
             interest = json.get_int();
         } else if( name == "horde_behaviour" ) {
-            horde_behaviour = json.get_string();
+            const std::string value = json.get_string();
+            if( value == "city" ) {
+                horde_behaviour = behaviour::city;
+            } else if( value == "roam" ) {
+                horde_behaviour = behaviour::roam;
+            } else {
+                horde_behaviour = behaviour::none;
+            }
         } else if( name == "monsters" ) {
             json.start_array();
             while( !json.end_array() ) {
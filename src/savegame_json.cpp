@@ -314,6 +314,7 @@ void Character::load(JsonObject &data)
             my_mutations.erase( it++ );
         }
     }
+    invalidate_trait_lookup();
 
     data.read( "my_bionics", my_bionics );
 
@@ -248,6 +248,10 @@ void item::load_info( const std::string &data )
 ///// overmap legacy deserialization, replaced with json serialization June 2015
 // throws std::exception (most likely as JsonError)
 void overmap::unserialize_legacy(std::istream & fin) {
+    for( auto &index : terrain_index ) {
+        index.clear();
+    }
+    clear_glyph_cache( 0, OVERMAP_LAYERS );
     // DEBUG VARS
     int nummg = 0;
     char datatype;
@@ -296,7 +300,7 @@ void overmap::unserialize_legacy(std::istream & fin) {
                         }
                         count--;
                         layer[z].terrain[i][j] = tmp_otid; //otermap[tmp_ter].loadid;
-                        layer[z].visible[i][j] = false;
+                        layer[z].visible[map_layer::tile( i, j )] = false;
                     }
                 }
                 convert_terrain( needs_conversion );
@@ -462,7 +466,7 @@ void overmap::unserialize_view_legacy( std::istream &fin )
                             fin >> vis >> count;
                         }
                         count--;
-                        layer[z].visible[i][j] = (vis == 1);
+                        layer[z].visible[map_layer::tile( i, j )] = (vis == 1);
                     }
                 }
             }
@@ -481,7 +485,7 @@ void overmap::unserialize_view_legacy( std::istream &fin )
                             fin >> explored >> count;
                         }
                         count--;
-                        layer[z].explored[i][j] = (explored == 1);
+                        layer[z].explored[map_layer::tile( i, j )] = (explored == 1);
                     }
                 }
             }
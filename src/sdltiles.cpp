@@ -1188,6 +1188,7 @@ long sdl_keysym_to_curses(SDL_Keysym keysym)
 //Check for any window messages (keypress, paint, mousemove, etc)
 void CheckMessages()
 {
+    static const cached_option<std::string> hide_cursor( "HIDE_CURSOR" );
     SDL_Event ev;
     bool quit = false;
     if(HandleDPad()) {
@@ -1217,7 +1218,7 @@ void CheckMessages()
             case SDL_KEYDOWN:
             {
                 //hide mouse cursor on keyboard input
-                if(get_option<std::string>( "HIDE_CURSOR" ) != "show" && SDL_ShowCursor(-1)) {
+                if( hide_cursor.get() != "show" && SDL_ShowCursor(-1)) {
                     SDL_ShowCursor(SDL_DISABLE);
                 }
                 const Uint8 *keystate = SDL_GetKeyboardState(NULL);
@@ -1265,7 +1266,7 @@ void CheckMessages()
                 // TODO: somehow get the "digipad" values from the axes
             break;
             case SDL_MOUSEMOTION:
-                if (get_option<std::string>( "HIDE_CURSOR" ) == "show" || get_option<std::string>( "HIDE_CURSOR" ) == "hidekb") {
+                if( hide_cursor.get() == "show" || hide_cursor.get() == "hidekb" ) {
                     if (!SDL_ShowCursor(-1)) {
                         SDL_ShowCursor(SDL_ENABLE);
                     }
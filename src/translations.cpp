@@ -1,7 +1,23 @@
 #include "translations.h"
 
+#include "catacharset.h"
+
 #include <string>
 
+static int current_translation_generation = 0;
+
+int translation_generation()
+{
+    return current_translation_generation;
+}
+
+void cached_translation::update() const
+{
+    translated = _( msgid );
+    translated_width = utf8_width( translated );
+    generation = current_translation_generation;
+}
+
 #ifdef LOCALIZE
 #undef __STRICT_ANSI__ // _putenv in minGW need that
 #include <stdlib.h> // for getenv()/setenv()/putenv()
@@ -88,6 +104,7 @@ void set_language( bool reload_options )
     bindtextdomain( "cataclysm-dda", locale_dir );
     bind_textdomain_codeset( "cataclysm-dda", "UTF-8" );
     textdomain( "cataclysm-dda" );
+    current_translation_generation++;
 
     // Step 3. Reload options strings with right language
     if( reload_options ) {
@@ -104,6 +121,7 @@ void set_language( bool reload_options )
 void set_language( bool reload_options )
 {
     ( void ) reload_options; // Cancels MinGW warning on Windows
+    current_translation_generation++;
 }
 
 // sanitized message cache
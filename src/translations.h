@@ -47,6 +47,51 @@ const char *strip_positional_formatting( const char *msgid );
 #define npgettext(STRING0, STRING1, STRING2, COUNT) ngettext(STRING1, STRING2, COUNT)
 
 #endif // LOCALIZE
+
+// Marks a string for extraction into the translation template, without translating it.
+#ifndef gettext_noop
+#define gettext_noop(x) x
+#endif
+
 void set_language( bool reload_options );
 
+/** Changes whenever @ref set_language is called, translated strings from before may be stale. */
+int translation_generation();
+
+/**
+ * The translation of a string literal that is shown again and again, e.g. a sidebar label.
+ * It is looked up only once per language, and its display width (see @ref utf8_width) is
+ * remembered along with it. Meant to be a function local static:
+ *
+ *     static const cached_translation focus_label( gettext_noop( "Focus" ) );
+ *     wprintz( w, c_white, focus_label.c_str() );
+ */
+class cached_translation
+{
+    public:
+        explicit cached_translation( const char *msgid ) : msgid( msgid ) {
+        }
+
+        const char *c_str() const {
+            if( generation != translation_generation() ) {
+                update();
+            }
+            return translated;
+        }
+        int width() const {
+            if( generation != translation_generation() ) {
+                update();
+            }
+            return translated_width;
+        }
+
+    private:
+        void update() const;
+
+        const char *msgid;
+        mutable const char *translated = nullptr;
+        mutable int translated_width = 0;
+        mutable int generation = -1;
+};
+
 #endif // _TRANSLATIONS_H_
@@ -312,13 +312,8 @@ void vpart_info::finalize()
             e.second.z_order = 0;
             e.second.list_order = 5;
         }
-    }
-}
 
-void vpart_info::check()
-{
-    for( auto &vp : vpart_info_all ) {
-        auto &part = vp.second;
+        auto &part = e.second;
 
         // handle legacy parts without requirement data
         // @todo deprecate once requirements are entirely loaded from JSON
@@ -373,6 +368,13 @@ void vpart_info::check()
         if( part.removal_moves < 0 ) {
             part.removal_moves = part.install_moves / 2;
         }
+    }
+}
+
+void vpart_info::check()
+{
+    for( auto &vp : vpart_info_all ) {
+        auto &part = vp.second;
 
         for( auto &e : part.install_skills ) {
             if( !e.first.is_valid() ) {
@@ -2347,7 +2347,8 @@ nc_color vehicle::part_color( const int p, const bool exact ) const
     int parm = -1;
 
     //If armoring is present and the option is set, it colors the visible part
-    if( get_option<bool>( "VEHICLE_ARMOR_COLOR" ) ) {
+    static const cached_option<bool> vehicle_armor_color( "VEHICLE_ARMOR_COLOR" );
+    if( vehicle_armor_color.get() ) {
         parm = part_with_feature(p, VPFLAG_ARMOR, false);
     }
 
@@ -2450,10 +2451,12 @@ int vehicle::print_part_desc(WINDOW *win, int y1, const int max_y, int width, in
 
         if (i == 0 && is_inside(pl[i])) {
             //~ indicates that a vehicle part is inside
-            mvwprintz(win, y, width-2-utf8_width(_("Interior")), c_ltgray, _("Interior"));
+            static const cached_translation interior( gettext_noop( "Interior" ) );
+            mvwprintz( win, y, width - 2 - interior.width(), c_ltgray, "%s", interior.c_str() );
         } else if (i == 0) {
             //~ indicates that a vehicle part is outside
-            mvwprintz(win, y, width-2-utf8_width(_("Exterior")), c_ltgray, _("Exterior"));
+            static const cached_translation exterior( gettext_noop( "Exterior" ) );
+            mvwprintz( win, y, width - 2 - exterior.width(), c_ltgray, "%s", exterior.c_str() );
         }
         y++;
     }
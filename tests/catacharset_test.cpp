@@ -0,0 +1,23 @@
+#include "catch/catch.hpp"
+
+#include "catacharset.h"
+#include "translations.h"
+
+TEST_CASE( "utf8_width_of_mixed_text" ) {
+    CHECK( utf8_width( "" ) == 0 );
+    CHECK( utf8_width( "Focus" ) == 5 );
+    CHECK( utf8_width( "\xc3\xa9t\xc3\xa9" ) == 3 );
+    // CJK characters take two columns.
+    CHECK( utf8_width( "a\xe4\xb8\xad" ) == 3 );
+    CHECK( utf8_width( "<color_red>red</color> text", true ) == 8 );
+    CHECK( utf8_width( "<color_red>red</color>", false ) == 22 );
+}
+
+TEST_CASE( "cached_translation_follows_language_changes" ) {
+    static const cached_translation label( gettext_noop( "Focus" ) );
+    CHECK( label.width() == utf8_width( label.c_str() ) );
+    const int generation = translation_generation();
+    set_language( false );
+    CHECK( translation_generation() != generation );
+    CHECK( label.width() == utf8_width( label.c_str() ) );
+}
@@ -0,0 +1,97 @@
+#include "catch/catch.hpp"
+
+#include "json.h"
+#include "cata_utility.h"
+
+#include <functional>
+#include <sstream>
+#include <string>
+
+static std::string write_json( const std::function<void( JsonOut & )> &writer )
+{
+    std::ostringstream buffer;
+    JsonOut jsout( buffer );
+    writer( jsout );
+    return buffer.str();
+}
+
+TEST_CASE( "json_strings_are_escaped" )
+{
+    const std::string plain = "plain/text";
+    CHECK( write_json( [&plain]( JsonOut & jsout ) {
+        jsout.write( plain );
+    } ) == "\"plain/text\"" );
+    CHECK( write_json( []( JsonOut & jsout ) {
+        jsout.write( "quote\" backslash\\ newline\n tab\t bell\x07" );
+    } ) == "\"quote\\\" backslash\\\\ newline\\n tab\\t bell\\u0007\"" );
+    CHECK( write_json( []( JsonOut & jsout ) {
+        jsout.write( "" );
+    } ) == "\"\"" );
+}
+
+TEST_CASE( "json_members_with_literal_and_string_names" )
+{
+    const std::string name = "second";
+    CHECK( write_json( [&name]( JsonOut & jsout ) {
+        jsout.start_object();
+        jsout.member( "first", 1 );
+        jsout.member( name, std::string( "two" ) );
+        jsout.member( "third" );
+        jsout.write( true );
+        jsout.end_object();
+    } ) == "{\"first\":1,\"second\":\"two\",\"third\":true}" );
+}
+
+TEST_CASE( "json_object_member_lookup" )
+{
+    std::istringstream data( R"({ "b": 2, "a": "one", "//": "x", "//": "y", "c": [ 3 ] })" );
+    JsonIn jsin( data );
+    JsonObject jo = jsin.get_object();
+
+    CHECK( jo.get_int( "b" ) == 2 );
+    CHECK( jo.get_string( "a" ) == "one" );
+    CHECK( jo.get_int_array( "c" ) == std::vector<int>( { 3 } ) );
+    CHECK( jo.get_int( "missing", 5 ) == 5 );
+    CHECK_FALSE( jo.has_member( "missing" ) );
+    // Looking up missing members does not add them.
+    CHECK( jo.get_member_names() == std::set<std::string>( { "//", "a", "b", "c" } ) );
+
+    std::istringstream prefixed( R"({ "ab": 1, "a": 2, "abc": 3 })" );
+    JsonIn prefixed_jsin( prefixed );
+    JsonObject prefixed_jo = prefixed_jsin.get_object();
+    // literal names and std::string names find the same members
+    CHECK( prefixed_jo.get_int( "a" ) == 2 );
+    CHECK( prefixed_jo.get_int( std::string( "ab" ) ) == 1 );
+    CHECK( prefixed_jo.get_int( "abc" ) == 3 );
+    CHECK_FALSE( prefixed_jo.has_member( "abcd" ) );
+    CHECK_FALSE( prefixed_jo.has_member( std::string( "b" ) ) );
+
+    std::istringstream duplicated( R"({ "a": 1, "a": 2 })" );
+    JsonIn dup_jsin( duplicated );
+    CHECK_THROWS_AS( dup_jsin.get_object(), const JsonError & );
+}
+
+TEST_CASE( "json_from_memory_stream" )
+{
+    const std::string data = R"([ { "name": "first", "value": 1 }, { "value": 2, "name": "second" } ])";
+    imemstream stream( data.data(), data.size() );
+    JsonIn jsin( stream );
+
+    std::vector<std::string> names;
+    jsin.start_array();
+    while( !jsin.end_array() ) {
+        JsonObject jo = jsin.get_object();
+        // member lookup seeks back and forth in the stream
+        CHECK( jo.get_int( "value" ) == int( names.size() + 1 ) );
+        names.push_back( jo.get_string( "name" ) );
+    }
+    CHECK( names == std::vector<std::string>( { "first", "second" } ) );
+
+    jsin.seek( 1 );
+    CHECK( jsin.tell() == 1 );
+    jsin.eat_whitespace();
+    CHECK( jsin.peek() == '{' );
+    // seeking beyond the end fails like it does on other streams
+    stream.seekg( data.size() + 1 );
+    CHECK( stream.fail() );
+}
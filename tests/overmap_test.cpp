@@ -2,6 +2,9 @@
 
 #include "overmap.h"
 
+#include <algorithm>
+#include <sstream>
+
 TEST_CASE( "set_and_get_overmap_scents" ) {
     overmap test_overmap;
 
@@ -19,3 +22,95 @@ TEST_CASE( "set_and_get_overmap_scents" ) {
     REQUIRE( test_overmap.scent_at( { 75, 85, 0} ).creation_turn == 50 );
     REQUIRE( test_overmap.scent_at( { 75, 85, 0} ).initial_strength == 90 );
 }
+
+TEST_CASE( "find_ot_types_follows_terrain_changes" ) {
+    overmap test_overmap;
+    const std::vector<oter_id> houses = find_ot_types( "house" );
+    REQUIRE( !houses.empty() );
+    CHECK( test_overmap.find_ot_types( houses, 0 ).empty() );
+
+    test_overmap.set_ter( 10, 20, 0, oter_id( "house_north" ) );
+    test_overmap.set_ter( 30, 40, 0, oter_id( "house_east" ) );
+    std::vector<point> found = test_overmap.find_ot_types( houses, 0 );
+    REQUIRE( found.size() == 2 );
+    CHECK( std::find( found.begin(), found.end(), point( 10, 20 ) ) != found.end() );
+    CHECK( std::find( found.begin(), found.end(), point( 30, 40 ) ) != found.end() );
+    CHECK( test_overmap.find_ot_types( houses, -1 ).empty() );
+
+    test_overmap.set_ter( 10, 20, 0, oter_id( "field" ) );
+    found = test_overmap.find_ot_types( houses, 0 );
+    REQUIRE( found.size() == 1 );
+    CHECK( found[0] == point( 30, 40 ) );
+}
+
+TEST_CASE( "mongroup_map_finds_moved_groups" ) {
+    mongroup_map groups;
+    groups.insert( mongroup( mongroup_id( "GROUP_ZOMBIE" ), 3, 4, 0, 1, 10 ) );
+    groups.insert( mongroup( mongroup_id( "GROUP_ZOMBIE" ), 3, 4, 0, 1, 20 ) );
+    groups.insert( mongroup( mongroup_id( "GROUP_ZOMBIE" ), -1, -1, 0, 1, 30 ) );
+
+    std::vector<mongroup *> found = groups.at( tripoint( 3, 4, 0 ) );
+    REQUIRE( found.size() == 2 );
+    CHECK( found[0]->population == 10 );
+    CHECK( found[1]->population == 20 );
+    CHECK( groups.at( tripoint( 3, 4, 1 ) ).empty() );
+
+    // Into another cell of the grid and back.
+    groups.move( 0, tripoint( 3 + mongroup_map::cell_size, 4, 0 ) );
+    CHECK( groups.at( tripoint( 3, 4, 0 ) ).size() == 1 );
+    CHECK( groups.at( tripoint( 3 + mongroup_map::cell_size, 4, 0 ) ).size() == 1 );
+    groups.move( 0, tripoint( 3, 4, 0 ) );
+    found = groups.at( tripoint( 3, 4, 0 ) );
+    REQUIRE( found.size() == 2 );
+    CHECK( found[0]->population == 10 );
+
+    REQUIRE( groups.at( tripoint( -1, -1, 0 ) ).size() == 1 );
+    groups.remove_if( []( const mongroup &mg ) {
+        return mg.population == 10;
+    } );
+    CHECK( groups.size() == 2 );
+    CHECK( groups.at( tripoint( 3, 4, 0 ) ).size() == 1 );
+    CHECK( groups.at( tripoint( -1, -1, 0 ) ).size() == 1 );
+}
+
+TEST_CASE( "overmap_scents_spread_and_fade" ) {
+    overmap test_overmap;
+    scent_trace test_scent( 50, 100 );
+    test_overmap.set_scent( { 75, 85, 0 }, test_scent );
+
+    test_overmap.diffuse_scents();
+    const int center = test_overmap.scent_at( { 75, 85, 0 } ).initial_strength;
+    const scent_trace next_to = test_overmap.scent_at( { 76, 85, 0 } );
+    CHECK( center < 100 );
+    CHECK( next_to.initial_strength > 0 );
+    CHECK( next_to.initial_strength < center );
+    CHECK( next_to.creation_turn == 50 );
+    CHECK( test_overmap.scent_at( { 75, 85, 1 } ).creation_turn == -1 );
+
+    // Eventually it's gone.
+    for( int i = 0; i < 200; ++i ) {
+        test_overmap.diffuse_scents();
+    }
+    CHECK( test_overmap.scent_at( { 75, 85, 0 } ).creation_turn == -1 );
+}
+
+TEST_CASE( "overmap_scents_survive_saving" ) {
+    overmap saved;
+    scent_trace test_scent( 50, 100 );
+    saved.set_scent( { 75, 85, 0 }, test_scent );
+    saved.diffuse_scents();
+
+    std::ostringstream out;
+    saved.serialize( out, false );
+    overmap loaded;
+    std::istringstream in( out.str() );
+    loaded.unserialize( in );
+    for( int x = 70; x <= 80; x++ ) {
+        for( int y = 80; y <= 90; y++ ) {
+            const scent_trace expected = saved.scent_at( { x, y, 0 } );
+            const scent_trace actual = loaded.scent_at( { x, y, 0 } );
+            CHECK( actual.creation_turn == expected.creation_turn );
+            CHECK( actual.initial_strength == expected.initial_strength );
+        }
+    }
+}
@@ -12,6 +12,7 @@
 #include "map.h"
 #include "weather.h"
 #include "itype.h"
+#include "mutation.h"
 
 #include <string>
 
@@ -132,3 +133,20 @@ TEST_CASE("Player body temperatures converge on expected values.", "[!mayfail]")
         test_temperature_spread( &dummy, {{ -115, -87, -54, -6, 36, 64, 80 }} );
     }
 }
+
+TEST_CASE( "has_trait_by_int_id_follows_mutations" ) {
+    player &dummy = g->u;
+    const trait_id sleepy( "SLEEPY" );
+    if( dummy.has_trait( "SLEEPY" ) ) {
+        dummy.toggle_trait( "SLEEPY" );
+    }
+    CHECK_FALSE( dummy.has_trait( sleepy ) );
+    dummy.toggle_trait( "SLEEPY" );
+    CHECK( dummy.has_trait( sleepy ) );
+    CHECK( dummy.has_trait( trait_id( "SLEEPY" ) ) );
+    dummy.toggle_trait( "SLEEPY" );
+    CHECK_FALSE( dummy.has_trait( sleepy ) );
+
+    CHECK_FALSE( dummy.has_trait( trait_id( "NOT_A_TRAIT" ) ) );
+    CHECK_FALSE( trait_id( "NOT_A_TRAIT" ).is_valid() );
+}
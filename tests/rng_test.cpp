@@ -0,0 +1,66 @@
+#include "catch/catch.hpp"
+
+#include "rng.h"
+
+#include <algorithm>
+#include <vector>
+
+static std::vector<long> draw_numbers()
+{
+    std::vector<long> result;
+    for( int i = 0; i < 100; ++i ) {
+        result.push_back( rng( 0, 1000 ) );
+    }
+    return result;
+}
+
+TEST_CASE( "rng_seed_scope_is_reproducible" ) {
+    std::vector<long> first;
+    {
+        rng_seed_scope scope( 42 );
+        first = draw_numbers();
+    }
+    std::vector<long> second;
+    {
+        rng_seed_scope scope( 42 );
+        second = draw_numbers();
+    }
+    CHECK( first == second );
+}
+
+TEST_CASE( "rng_seed_scope_nests" ) {
+    std::vector<long> expected;
+    {
+        rng_seed_scope scope( 7 );
+        expected = draw_numbers();
+        const std::vector<long> more = draw_numbers();
+        expected.insert( expected.end(), more.begin(), more.end() );
+    }
+    std::vector<long> outer;
+    {
+        rng_seed_scope scope( 7 );
+        outer = draw_numbers();
+        {
+            rng_seed_scope inner( 8 );
+            draw_numbers();
+        }
+        // The outer sequence continues where it left off.
+        const std::vector<long> more = draw_numbers();
+        outer.insert( outer.end(), more.begin(), more.end() );
+    }
+    CHECK( outer == expected );
+}
+
+TEST_CASE( "random_shuffle_rng_keeps_elements" ) {
+    rng_seed_scope scope( 3 );
+    std::vector<int> values;
+    for( int i = 0; i < 50; ++i ) {
+        values.push_back( i );
+    }
+    random_shuffle_rng( values.begin(), values.end() );
+    std::vector<int> sorted = values;
+    std::sort( sorted.begin(), sorted.end() );
+    for( int i = 0; i < 50; ++i ) {
+        CHECK( sorted[i] == i );
+    }
+}
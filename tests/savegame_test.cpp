@@ -6,6 +6,7 @@
 #include "overmap.h"
 
 #include <fstream>
+#include <sstream>
 #include <ostream>
 
 // Intentionally ignoring the name member.
@@ -231,3 +232,28 @@ TEST_CASE("Reading a legacy overmap save.") {
     // Now clean up.
     remove_file( new_save_name.c_str() );
 }
+
+TEST_CASE("Overmap terrain saved in chunks of layers.") {
+
+    overmap test_map;
+    std::ifstream fin( "tests/data/legacy_0.C_overmap.sav", std::ifstream::binary );
+    REQUIRE( fin.is_open() );
+    test_map.unserialize( fin );
+    fin.close();
+
+    std::ostringstream main_data;
+    test_map.serialize( main_data, false );
+    CHECK( main_data.str().find( "\"layers\"" ) == std::string::npos );
+
+    overmap test_map_2;
+    std::istringstream main_in( main_data.str() );
+    test_map_2.unserialize( main_in );
+    for( int chunk = 0; chunk < overmap::layer_chunks; ++chunk ) {
+        std::ostringstream chunk_data;
+        test_map.serialize_layer_chunk( chunk_data, chunk );
+        std::istringstream chunk_in( chunk_data.str() );
+        test_map_2.unserialize_layer_chunk( chunk_in, chunk );
+    }
+
+    check_test_overmap_data( test_map_2 );
+}